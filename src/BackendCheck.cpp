@@ -0,0 +1,482 @@
+#include "BackendCheck.h"
+#include "ParticleCPU.h"
+#include "ParticleKernel.h"
+#include "ParticlePhysics.h"
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+namespace {
+
+// Scne de test (mmes paramtres pour tous les backends)
+struct Scene {
+    const char* name;
+    unsigned int seed;
+    int count;
+    float radius;
+    int width;
+    int height;
+    float gravity;
+    float friction;
+    float rebound;
+    bool cursorActive;
+    int steps;
+    float clusterRadius;                // > 0 : particules regroupes au centre dans ce rayon
+
+    // Tolrances par rapport  la rfrence du backend (< 0 : non vrifi)
+    float trajectoryTolerance;          // cart de position au 95e centile (px)
+    float energyTolerance;              // cart d'nergie cintique / nergie maximale de la rfrence
+    float momentumTolerance;            // cart de quantit de mouvement / (N * vitesse quadratique moyenne)
+};
+
+const Scene SCENES[] = {
+    // Sans gravit et peu de contacts : les trajectoires doivent rester superposes
+    { "libre",      1234, 100,  0.5f, 800,  600,  0.0f,  0.05f, 0.7f, false, 120, 0.0f,   0.05f, 0.02f, 0.05f },
+    // Interaction souris active (rpulsion)
+    { "curseur",    4321, 100,  0.5f, 800,  600,  0.0f,  0.05f, 0.7f, true,  120, 0.0f,   0.05f, 0.02f, 0.05f },
+    // Tas sous gravit : l'ordre de rsolution des collisions diffre (squentiel CPU / parallle GPU),
+    // seules les grandeurs globales sont compares. Sol et murs ne conservent pas la quantit de mouvement.
+    { "dense",      9876, 1500, 6.0f, 800,  600,  9.81f, 0.05f, 0.7f, false, 120, 0.0f,  -1.0f, 0.08f, 0.12f },
+    // Amas qui explose loin des murs, sans gravit : seules les collisions agissent sur la quantit
+    // de mouvement (la friction la rduit du mme facteur partout). Une rponse non symtrique choue ici.
+    // L'nergie dissipe pendant l'explosion dpend de l'ordre de rsolution : tolrance large.
+    { "amas",       2468, 1000, 6.0f, 4000, 4000, 0.0f,  0.05f, 0.7f, false, 120, 150.0f, -1.0f, 0.20f, 0.001f },
+};
+
+// Scnes de flux : dures de vie finies (en pas) et puits central optionnel.
+// Physique de la scne "libre" sans collisions, chaque particule porte son identifiant (ordre des survivantes).
+struct StreamScene {
+    const char* name;
+    unsigned int seed;
+    int count;
+    float sinkRadius;                   // 0 : pas de puits, chaque particule meurt exactement  son chance
+    int minLifeSteps;
+    int maxLifeSteps;
+};
+
+const StreamScene STREAM_SCENES[] = {
+    { "durees", 1357, 2000, 0.0f,   5, 100 },
+    { "puits",  2468, 2000, 150.0f, 5, 200 },
+};
+
+// Paramtres curseur de la scne "curseur"
+const float CURSOR_X = 400.0f;
+const float CURSOR_Y = 300.0f;
+const float CURSOR_STRENGTH = -2.0f;
+const float CURSOR_RADIUS = 150.0f;
+
+// Intervalle d'chantillonnage des trajectoires (pas)
+const int SAMPLE_EVERY = 10;
+
+// Dbit : scne "libre"  THROUGHPUT_COUNT particules (collisions comprises).
+// Plancher absolu = BASELINE_FLOOR_RATIO x mesure de rfrence du backend (la marge absorbe l'cart entre machines),
+// vrifi seulement sur un build optimis : sans optimisation le code CPU est 2  3 fois plus lent.
+const int THROUGHPUT_COUNT = 1000;
+const float THROUGHPUT_SECONDS = 0.5f;
+const float BASELINE_FLOOR_RATIO = 0.5f;
+
+// Dbit de flux : STREAM_THROUGHPUT_COUNT particules  dure de vie courte (1  STREAM_THROUGHPUT_MAX_LIFE
+// pas), chaque destruction est rmise au pas suivant comme par l'metteur en rgime tabli.
+// Plancher en crations + destructions par seconde, vrifi seulement sur un build optimis.
+const int STREAM_THROUGHPUT_COUNT = 1000000;
+const int STREAM_THROUGHPUT_MAX_LIFE = 60;
+const float STREAM_THROUGHPUT_FLOOR = 1.0e6f;
+
+#if defined(NDEBUG) || defined(__OPTIMIZE__)
+const bool OPTIMIZED_BUILD = true;
+#else
+const bool OPTIMIZED_BUILD = false;
+#endif
+
+// Chaque backend est compar  un backend CPU (index dans BACKENDS).
+//
+// Mesure de rfrence (pas/s) releve par "--check-backends" sur un build optimis :
+// CPU : Intel Xeon (machine virtuelle, 1 coeur), g++ -O2, mdiane de 5 excutions.
+// Le GPU n'a pas de mesure absolue : son dbit est compar  celui de sa rfrence CPU
+// mesur dans la mme excution (mme machine, mme build), ce qui ne demande aucun relev.
+struct Backend {
+    const char* name;
+    bool gpu;
+    int reference;
+    float baselineStepsPerSecond;       // 0 : pas de plancher absolu
+    float minReferenceSpeedup;          // dbit minimal / dbit de la rfrence (0 : non vrifi)
+};
+
+const Backend BACKENDS[] = {
+    { "CPU", false, 0, 506.0f, 0.0f },
+    { "GPU", true,  0, 0.0f,   2.0f },
+};
+const int BACKEND_COUNT = sizeof(BACKENDS) / sizeof(BACKENDS[0]);
+const int SCENE_COUNT = sizeof(SCENES) / sizeof(SCENES[0]);
+const int STREAM_SCENE_COUNT = sizeof(STREAM_SCENES) / sizeof(STREAM_SCENES[0]);
+
+std::vector<Particle> makeScene(const Scene& s) {
+    std::mt19937 rng(s.seed);
+    std::uniform_real_distribution<float> posX(s.radius, s.width - s.radius);
+    std::uniform_real_distribution<float> posY(s.radius, s.height - s.radius);
+    std::uniform_real_distribution<float> vel(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    std::vector<Particle> particles(s.count);
+    for (auto& p : particles) {
+        if (s.clusterRadius > 0.0f) {
+            // Tirage uniforme dans le disque central
+            float r = s.clusterRadius * std::sqrt(unit(rng));
+            float a = unit(rng) * 6.2831853f;
+            p.position = { s.width * 0.5f + r * std::cos(a), s.height * 0.5f + r * std::sin(a) };
+        }
+        else {
+            p.position = { posX(rng), posY(rng) };
+        }
+        p.velocity = { vel(rng), vel(rng) };
+        p.radius = s.radius;
+        p.color = { 255, 255, 255, 255 };
+        p.life = PARTICLE_IMMORTAL;
+    }
+    return particles;
+}
+
+// Un pas de simulation sur le backend choisi. Les survivantes restent en tte du tableau,
+// qui est rduit au nombre renvoy par le backend.
+void stepBackend(const Backend& b, const Scene& s, std::vector<Particle>& particles, const Sink* sinks = nullptr, int sinkCount = 0) {
+    float dt = SIMULATION_DT;
+    float mouseX = s.cursorActive ? CURSOR_X : -1000.0f;
+    float mouseY = s.cursorActive ? CURSOR_Y : -1000.0f;
+
+    auto update = b.gpu ? updateParticlesCUDA : updateParticlesCPU;
+    int alive = update(particles.data(), (int)particles.size(), dt, s.gravity, s.friction, s.rebound, s.width, s.height,
+        mouseX, mouseY, CURSOR_STRENGTH, CURSOR_RADIUS, s.cursorActive, sinks, sinkCount);
+    particles.resize(alive);
+}
+
+// Excute une scne et renvoie les tats chantillonns
+std::vector<std::vector<Particle>> runScene(const Backend& b, const Scene& s) {
+    std::vector<Particle> particles = makeScene(s);
+
+    std::vector<std::vector<Particle>> samples;
+    for (int step = 1; step <= s.steps; step++) {
+        stepBackend(b, s, particles);
+
+        if (step % SAMPLE_EVERY == 0 || step == s.steps) {
+            samples.push_back(particles);
+        }
+    }
+    return samples;
+}
+
+bool sameSamples(const std::vector<std::vector<Particle>>& a, const std::vector<std::vector<Particle>>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t k = 0; k < a.size(); k++) {
+        for (size_t i = 0; i < a[k].size(); i++) {
+            if (std::memcmp(&a[k][i].position, &b[k][i].position, sizeof(Vector2)) != 0) return false;
+            if (std::memcmp(&a[k][i].velocity, &b[k][i].velocity, sizeof(Vector2)) != 0) return false;
+        }
+    }
+    return true;
+}
+
+// Ecart de position au centile donn, pire chantillon.
+// Quelques particules peuvent bifurquer sur un contact limite : elles ne doivent pas masquer une drive gnrale.
+float trajectoryError(const std::vector<std::vector<Particle>>& ref, const std::vector<std::vector<Particle>>& other, int percentile) {
+    float worst = 0.0f;
+    std::vector<float> errors;
+    for (size_t k = 0; k < ref.size(); k++) {
+        errors.clear();
+        for (size_t i = 0; i < ref[k].size(); i++) {
+            float dx = ref[k][i].position.x - other[k][i].position.x;
+            float dy = ref[k][i].position.y - other[k][i].position.y;
+            errors.push_back(std::sqrt(dx * dx + dy * dy));
+        }
+        size_t rank = errors.size() * percentile / 100;
+        std::nth_element(errors.begin(), errors.begin() + rank, errors.end());
+        if (errors[rank] > worst) worst = errors[rank];
+    }
+    return worst;
+}
+
+double kineticEnergy(const std::vector<Particle>& particles) {
+    double e = 0.0;
+    for (const auto& p : particles) e += 0.5 * ((double)p.velocity.x * p.velocity.x + (double)p.velocity.y * p.velocity.y);
+    return e;
+}
+
+Vector2 momentum(const std::vector<Particle>& particles) {
+    double px = 0.0, py = 0.0;
+    for (const auto& p : particles) {
+        px += p.velocity.x;
+        py += p.velocity.y;
+    }
+    return { (float)px, (float)py };
+}
+
+// Pires carts d'nergie et de quantit de mouvement sur tous les chantillons,
+// rapports  l'nergie maximale de la rfrence (l'nergie d'un tas au repos tend vers 0)
+void conservationErrors(const Scene& s, const std::vector<std::vector<Particle>>& ref, const std::vector<std::vector<Particle>>& other,
+    float& energyError, float& momentumError) {
+
+    double energyScale = kineticEnergy(makeScene(s));
+    for (const auto& sample : ref) {
+        double e = kineticEnergy(sample);
+        if (e > energyScale) energyScale = e;
+    }
+    double momentumScale = std::sqrt(2.0 * energyScale / s.count) * s.count;
+
+    energyError = 0.0f;
+    momentumError = 0.0f;
+    if (energyScale <= 0.0) return;
+
+    for (size_t k = 0; k < ref.size(); k++) {
+        float eErr = (float)(std::fabs(kineticEnergy(other[k]) - kineticEnergy(ref[k])) / energyScale);
+        if (eErr > energyError) energyError = eErr;
+
+        Vector2 mRef = momentum(ref[k]);
+        Vector2 mOther = momentum(other[k]);
+        float dx = mOther.x - mRef.x;
+        float dy = mOther.y - mRef.y;
+        float mErr = (float)(std::sqrt(dx * dx + dy * dy) / momentumScale);
+        if (mErr > momentumError) momentumError = mErr;
+    }
+}
+
+// Scne de flux : identifiants dans la couleur,
+// dure de vie de k pas -> (k - 0.5) * dt : la particule disparat exactement au pas k
+std::vector<Particle> makeStreamScene(const Scene& physics, const StreamScene& s, std::vector<int>& lifeSteps) {
+    std::vector<Particle> particles = makeScene(physics);
+    std::mt19937 rng(s.seed);
+    std::uniform_int_distribution<int> life(s.minLifeSteps, s.maxLifeSteps);
+
+    lifeSteps.resize(s.count);
+    for (int i = 0; i < s.count; i++) {
+        lifeSteps[i] = life(rng);
+        particles[i].color = { (unsigned char)(i & 0xff), (unsigned char)((i >> 8) & 0xff), (unsigned char)((i >> 16) & 0xff), 255 };
+        particles[i].life = (lifeSteps[i] - 0.5f) * SIMULATION_DT;
+    }
+    return particles;
+}
+
+// Excute une scne de flux et renvoie le pas de destruction de chaque particule (0 : vivante  la fin).
+// ordered = false si les survivantes ne sont pas restes dans l'ordre des identifiants.
+std::vector<int> runStreamScene(const Backend& b, const Scene& physics, const StreamScene& s, bool& ordered) {
+    std::vector<int> lifeSteps;
+    std::vector<Particle> particles = makeStreamScene(physics, s, lifeSteps);
+
+    Sink sink = { { physics.width * 0.5f, physics.height * 0.5f }, s.sinkRadius };
+    int sinkCount = s.sinkRadius > 0.0f ? 1 : 0;
+
+    std::vector<int> deathSteps(s.count, 0);
+    std::vector<char> alive(s.count, 1);
+    std::vector<char> seen(s.count);
+    ordered = true;
+
+    for (int step = 1; step <= physics.steps; step++) {
+        stepBackend(b, physics, particles, &sink, sinkCount);
+
+        // Identifiants des survivantes, strictement croissants si l'ordre est conserv
+        std::fill(seen.begin(), seen.end(), 0);
+        int previous = -1;
+        for (size_t k = 0; k < particles.size(); k++) {
+            int id = particles[k].color.r | (particles[k].color.g << 8) | (particles[k].color.b << 16);
+            if (id <= previous || id >= s.count) ordered = false;
+            else seen[id] = 1;
+            previous = id;
+        }
+
+        for (int i = 0; i < s.count; i++) {
+            if (alive[i] && !seen[i]) {
+                alive[i] = 0;
+                deathSteps[i] = step;
+            }
+        }
+    }
+    return deathSteps;
+}
+
+float measureThroughput(const Backend& b) {
+    Scene s = SCENES[0];
+    s.count = THROUGHPUT_COUNT;
+    std::vector<Particle> particles = makeScene(s);
+
+    // Pas de chauffe (allocation GPU, caches)
+    stepBackend(b, s, particles);
+
+    int steps = 0;
+    auto start = std::chrono::steady_clock::now();
+    float elapsed = 0.0f;
+    while (elapsed < THROUGHPUT_SECONDS) {
+        stepBackend(b, s, particles);
+        steps++;
+        elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    }
+    return steps / elapsed;
+}
+
+// Crations + destructions par seconde sur la scne de flux de dbit
+float measureStreamThroughput(const Backend& b) {
+    Scene s = SCENES[0];
+    s.count = STREAM_THROUGHPUT_COUNT;
+    std::vector<Particle> templates = makeScene(s);
+
+    std::mt19937 rng(s.seed);
+    std::uniform_int_distribution<int> life(1, STREAM_THROUGHPUT_MAX_LIFE);
+    for (auto& p : templates) p.life = (life(rng) - 0.5f) * SIMULATION_DT;
+
+    std::vector<Particle> particles = templates;
+    size_t next = 0;
+
+    // Rmission des particules dtruites (capacit rserve : aucune allocation pendant la mesure)
+    auto respawn = [&]() {
+        while ((int)particles.size() < s.count) {
+            particles.push_back(templates[next]);
+            next = (next + 1) % templates.size();
+        }
+    };
+
+    // Pas de chauffe (allocation GPU, caches)
+    stepBackend(b, s, particles);
+    respawn();
+
+    long long churn = 0;
+    auto start = std::chrono::steady_clock::now();
+    float elapsed = 0.0f;
+    while (elapsed < THROUGHPUT_SECONDS) {
+        stepBackend(b, s, particles);
+        churn += 2 * (s.count - (long long)particles.size());
+        respawn();
+        elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    }
+    return churn / elapsed;
+}
+
+}
+
+bool runBackendCheck() {
+    bool gpuAvailable = isCudaAvailable();
+    bool allPassed = true;
+
+    printf("Verification des backends (GPU %s)\n", gpuAvailable ? "disponible" : "absent");
+
+    // Etats chantillonns [backend][scne] (les backends CPU servent de rfrence)
+    std::vector<std::vector<std::vector<std::vector<Particle>>>> results(BACKEND_COUNT);
+    std::vector<std::vector<std::vector<int>>> streamResults(BACKEND_COUNT);
+    std::vector<float> throughput(BACKEND_COUNT, 0.0f);
+
+    for (int bi = 0; bi < BACKEND_COUNT; bi++) {
+        const Backend& b = BACKENDS[bi];
+        if (b.gpu && !gpuAvailable) {
+            printf("[SKIP] %s : pas de GPU CUDA\n", b.name);
+            continue;
+        }
+
+        const Backend& reference = BACKENDS[b.reference];
+        for (int k = 0; k < SCENE_COUNT; k++) {
+            const Scene& s = SCENES[k];
+            results[bi].push_back(runScene(b, s));
+            const auto& samples = results[bi][k];
+            const auto& referenceSamples = results[b.reference][k];
+            bool passed = true;
+
+            // Dterminisme : deux excutions identiques au bit prs
+            bool deterministic = sameSamples(samples, runScene(b, s));
+            passed &= deterministic;
+
+            float trajError = trajectoryError(referenceSamples, samples, 95);
+            if (s.trajectoryTolerance >= 0.0f) passed &= trajError <= s.trajectoryTolerance;
+
+            float energyError, momentumError;
+            conservationErrors(s, referenceSamples, samples, energyError, momentumError);
+            if (s.energyTolerance >= 0.0f) passed &= energyError <= s.energyTolerance;
+            if (s.momentumTolerance >= 0.0f) passed &= momentumError <= s.momentumTolerance;
+
+            printf("[%s] %s / %s (ref. %s) : deterministe %s, trajectoire (p95) %.4f px, energie %.2f%%, quantite de mouvement %.3f%%\n",
+                passed ? "OK" : "ECHEC", b.name, s.name, reference.name, deterministic ? "oui" : "non",
+                trajError, energyError * 100.0f, momentumError * 100.0f);
+            allPassed &= passed;
+        }
+
+        // Flux : nombre de survivantes, ordre et pas de destruction
+        for (int k = 0; k < STREAM_SCENE_COUNT; k++) {
+            const StreamScene& s = STREAM_SCENES[k];
+            Scene physics = SCENES[0];
+            physics.count = s.count;
+            physics.radius = 0.0f; // sans contacts : seules l'intgration et la compaction interviennent
+
+            std::vector<int> lifeSteps;
+            makeStreamScene(physics, s, lifeSteps);
+
+            bool ordered;
+            streamResults[bi].push_back(runStreamScene(b, physics, s, ordered));
+            const auto& deaths = streamResults[bi][k];
+            const auto& referenceDeaths = streamResults[b.reference][k];
+
+            // Aucune particule ne survit  son chance ; sans puits, elle meurt exactement  son chance
+            bool onTime = true;
+            int survivors = 0;
+            for (int i = 0; i < s.count; i++) {
+                int expected = lifeSteps[i] <= physics.steps ? lifeSteps[i] : 0;
+                if (deaths[i] == 0) survivors++;
+                if (expected != 0 && (deaths[i] == 0 || deaths[i] > expected)) onTime = false;
+                if (s.sinkRadius <= 0.0f && deaths[i] != expected) onTime = false;
+            }
+
+            // Destructions identiques  la rfrence au pas prs
+            int mismatches = 0;
+            for (int i = 0; i < s.count; i++) mismatches += deaths[i] != referenceDeaths[i];
+            float mismatchRatio = (float)mismatches / s.count;
+
+            bool passed = ordered && onTime && mismatches == 0;
+            printf("[%s] %s / flux %s (ref. %s) : ordre conserve %s, echeances respectees %s, destructions differentes %.2f%%, %d survivantes\n",
+                passed ? "OK" : "ECHEC", b.name, s.name, reference.name, ordered ? "oui" : "non", onTime ? "oui" : "non",
+                mismatchRatio * 100.0f, survivors);
+            allPassed &= passed;
+        }
+
+        float stepsPerSecond = measureThroughput(b);
+        throughput[bi] = stepsPerSecond;
+
+        // Plancher absolu (build optimis uniquement)
+        if (b.baselineStepsPerSecond > 0.0f) {
+            float floor = b.baselineStepsPerSecond * BASELINE_FLOOR_RATIO;
+            if (!OPTIMIZED_BUILD) {
+                printf("[INFO] %s / debit : %.0f pas/s (build non optimise : plancher %.0f non verifie, %d particules)\n",
+                    b.name, stepsPerSecond, floor, THROUGHPUT_COUNT);
+            }
+            else {
+                bool fastEnough = stepsPerSecond >= floor;
+                printf("[%s] %s / debit : %.0f pas/s (plancher %.0f = %.0f%% de la reference %.0f, %d particules)\n",
+                    fastEnough ? "OK" : "ECHEC", b.name, stepsPerSecond, floor, BASELINE_FLOOR_RATIO * 100.0f,
+                    b.baselineStepsPerSecond, THROUGHPUT_COUNT);
+                allPassed &= fastEnough;
+            }
+        }
+
+        // Flux de millions de particules : collisions dsactives au-del des limites des backends
+        float churn = measureStreamThroughput(b);
+        if (!OPTIMIZED_BUILD) {
+            printf("[INFO] %s / debit flux : %.2f M creations+destructions/s (build non optimise : plancher %.1f M non verifie, %d particules)\n",
+                b.name, churn / 1.0e6f, STREAM_THROUGHPUT_FLOOR / 1.0e6f, STREAM_THROUGHPUT_COUNT);
+        }
+        else {
+            bool fastEnough = churn >= STREAM_THROUGHPUT_FLOOR;
+            printf("[%s] %s / debit flux : %.2f M creations+destructions/s (plancher %.1f M, %d particules)\n",
+                fastEnough ? "OK" : "ECHEC", b.name, churn / 1.0e6f, STREAM_THROUGHPUT_FLOOR / 1.0e6f, STREAM_THROUGHPUT_COUNT);
+            allPassed &= fastEnough;
+        }
+
+        // Plancher relatif  la rfrence mesure dans la mme excution (indpendant de la machine et du build)
+        if (b.minReferenceSpeedup > 0.0f) {
+            float floor = throughput[b.reference] * b.minReferenceSpeedup;
+            bool fastEnough = stepsPerSecond >= floor;
+            printf("[%s] %s / debit : %.0f pas/s (plancher %.0f = %.1fx %s, %d particules)\n",
+                fastEnough ? "OK" : "ECHEC", b.name, stepsPerSecond, floor, b.minReferenceSpeedup,
+                reference.name, THROUGHPUT_COUNT);
+            allPassed &= fastEnough;
+        }
+    }
+
+    printf("%s\n", allPassed ? "Tous les backends sont conformes" : "Au moins un backend n'est pas conforme");
+    return allPassed;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// Vrification croise des backends (CPU / GPU)
+// - scnes identiques gnres avec une graine fixe
+// - dterminisme, trajectoires, nergie cintique et quantit de mouvement compares  un backend CPU
+// - flux (dures de vie finies, puits) : survivantes, ordre conserv, pas de destruction
+// - dbit minimal (pas/s) : CPU par rapport  sa mesure de rfrence (build optimis),
+//   GPU par rapport au CPU mesur dans la mme excution
+// - les backends GPU sont ignors sans carte CUDA
+// Renvoie true si tous les backends disponibles passent.
+bool runBackendCheck();
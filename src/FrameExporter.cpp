@@ -0,0 +1,228 @@
+#include "FrameExporter.h"
+#include <QImage>
+#include <QString>
+#include <cstring>
+#include <filesystem>
+
+FrameExporter::~FrameExporter() {
+    stop();
+}
+
+bool FrameExporter::start(const std::string& outputDir, Format format, int width, int height, int fps,
+    int queueCapacity, int threadCount) {
+    if (m_running || width <= 0 || height <= 0) return false;
+
+    std::error_code ec;
+    std::filesystem::create_directories(outputDir, ec);
+    if (ec) {
+        fprintf(stderr, "Export : impossible de creer %s\n", outputDir.c_str());
+        return false;
+    }
+
+    m_outputDir = outputDir;
+    m_format = format;
+    m_width = width;
+    m_height = height;
+    m_fps = fps;
+
+    // Flux vido brut : en-tte unique, puis une entre "FRAME" par image (YUV 4:4:4)
+    if (m_format == Y4M) {
+        std::string path = m_outputDir + "/export.y4m";
+        m_y4mFile = fopen(path.c_str(), "wb");
+        if (!m_y4mFile) {
+            fprintf(stderr, "Export : impossible d'ouvrir %s\n", path.c_str());
+            return false;
+        }
+        fprintf(m_y4mFile, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n", m_width, m_height, m_fps);
+    }
+
+    // Nombre d'encodeurs : un coeur est laiss  la simulation
+    if (threadCount <= 0) {
+        int cores = (int)std::thread::hardware_concurrency();
+        threadCount = cores > 2 ? cores - 1 : 1;
+        if (threadCount > 4) threadCount = 4;
+    }
+
+    // Buffers allous une fois : file pleine + une frame en cours par encodeur
+    m_frames.clear();
+    m_frames.resize(queueCapacity + threadCount);
+    m_freeFrames.clear();
+    for (auto& f : m_frames) {
+        f.rgba.resize((size_t)m_width * m_height * 4);
+        m_freeFrames.push_back(&f);
+    }
+    m_queue.clear();
+
+    m_stopRequested = false;
+    m_nextIndex = 0;
+    m_nextToWrite = 0;
+    m_written = 0;
+    m_failed = 0;
+    m_stalls = 0;
+    m_startTime = std::chrono::steady_clock::now();
+    m_running = true;
+
+    for (int i = 0; i < threadCount; i++) {
+        m_workers.emplace_back(&FrameExporter::workerLoop, this);
+    }
+    return true;
+}
+
+void FrameExporter::stop() {
+    if (!m_running) return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopRequested = true;
+    }
+    m_queueCond.notify_all();
+    m_freeCond.notify_all();
+
+    // Les encodeurs vident la file avant de s'arrter
+    for (auto& t : m_workers) t.join();
+    m_workers.clear();
+
+    if (m_y4mFile) {
+        fclose(m_y4mFile);
+        m_y4mFile = nullptr;
+    }
+
+    fprintf(stderr, "Export termine : %d frames ecrites (%d erreurs), %.1f fps, %d attentes file pleine\n",
+        m_written, m_failed, exportFPS(), m_stalls);
+
+    m_running = false;
+    m_queue.clear();
+    m_freeFrames.clear();
+    std::vector<Frame>().swap(m_frames);
+}
+
+bool FrameExporter::submit(const unsigned char* rgba, int width, int height, bool flipY) {
+    if (!m_running || width != m_width || height != m_height) return false;
+
+    Frame* frame = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        // File pleine : seul cas o la simulation attend le disque
+        if (m_freeFrames.empty()) {
+            m_stalls++;
+            m_freeCond.wait(lock, [this] { return !m_freeFrames.empty() || m_stopRequested; });
+        }
+        if (m_stopRequested) return false;
+        frame = m_freeFrames.back();
+        m_freeFrames.pop_back();
+        frame->index = m_nextIndex++;
+    }
+
+    // Copie hors verrou
+    size_t rowSize = (size_t)m_width * 4;
+    if (flipY) {
+        for (int y = 0; y < m_height; y++) {
+            std::memcpy(frame->rgba.data() + y * rowSize, rgba + (size_t)(m_height - 1 - y) * rowSize, rowSize);
+        }
+    }
+    else {
+        std::memcpy(frame->rgba.data(), rgba, rowSize * m_height);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(frame);
+    }
+    m_queueCond.notify_one();
+    return true;
+}
+
+void FrameExporter::workerLoop() {
+    // Buffer YUV propre au thread, rutilis d'une frame  l'autre
+    std::vector<unsigned char> yuv;
+
+    while (true) {
+        Frame* frame = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_queueCond.wait(lock, [this] { return !m_queue.empty() || m_stopRequested; });
+            if (m_queue.empty()) return; // arrt demand et file vide
+            frame = m_queue.front();
+            m_queue.pop_front();
+        }
+
+        bool ok = true;
+        if (m_format == PNG) {
+            ok = writePNG(*frame);
+        }
+        else {
+            convertY4M(*frame, yuv);
+            ok = writeY4M(*frame, yuv);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (ok) m_written++;
+            else m_failed++;
+            m_freeFrames.push_back(frame);
+        }
+        m_freeCond.notify_one();
+    }
+}
+
+bool FrameExporter::writePNG(const Frame& frame) {
+    char name[32];
+    snprintf(name, sizeof(name), "/frame_%06ld.png", frame.index);
+    std::string path = m_outputDir + name;
+
+    // QImage est rentrant (contrairement  ExportImage de Raylib) : les encodeurs travaillent en parallle.
+    // L'image pointe sur le buffer de la frame, sans copie.
+    QImage image(frame.rgba.data(), m_width, m_height, m_width * 4, QImage::Format_RGBA8888);
+    return image.save(QString::fromStdString(path), "PNG");
+}
+
+// RGBA -> YUV 4:4:4 (BT.601, plage limite), plans Y puis U puis V
+void FrameExporter::convertY4M(const Frame& frame, std::vector<unsigned char>& yuv) const {
+    size_t pixelCount = (size_t)m_width * m_height;
+    yuv.resize(pixelCount * 3);
+    unsigned char* planeY = yuv.data();
+    unsigned char* planeU = planeY + pixelCount;
+    unsigned char* planeV = planeU + pixelCount;
+
+    const unsigned char* src = frame.rgba.data();
+    for (size_t i = 0; i < pixelCount; i++) {
+        int r = src[i * 4 + 0];
+        int g = src[i * 4 + 1];
+        int b = src[i * 4 + 2];
+        planeY[i] = (unsigned char)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+        planeU[i] = (unsigned char)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+        planeV[i] = (unsigned char)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+    }
+}
+
+// Le flux Y4M est squentiel : chaque encodeur attend le tour de sa frame
+bool FrameExporter::writeY4M(const Frame& frame, const std::vector<unsigned char>& yuv) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_orderCond.wait(lock, [this, &frame] { return m_nextToWrite == frame.index; });
+    lock.unlock();
+
+    bool ok = fputs("FRAME\n", m_y4mFile) >= 0
+        && fwrite(yuv.data(), 1, yuv.size(), m_y4mFile) == yuv.size();
+
+    lock.lock();
+    m_nextToWrite++;
+    lock.unlock();
+    m_orderCond.notify_all();
+    return ok;
+}
+
+int FrameExporter::framesWritten() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_written;
+}
+
+int FrameExporter::stalls() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stalls;
+}
+
+float FrameExporter::exportFPS() {
+    float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_startTime).count();
+    if (seconds <= 0.0f) return 0.0f;
+    return framesWritten() / seconds;
+}
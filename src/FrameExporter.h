@@ -0,0 +1,83 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdio>
+
+// Export hors-ligne des frames rendues (squence PNG ou vido brute Y4M)
+// - file d'attente borne : la simulation n'attend que si la file est pleine
+// - pool de threads d'encodage
+// - buffers de frames rutiliss (aucune allocation une fois l'export lanc)
+class FrameExporter {
+public:
+    enum Format {
+        PNG,
+        Y4M};
+
+    FrameExporter() = default;
+    ~FrameExporter();
+
+    FrameExporter(const FrameExporter&) = delete;
+    FrameExporter& operator=(const FrameExporter&) = delete;
+
+    // Dmarre l'export (taille de frame fixe, fps = cadence simule)
+    bool start(const std::string& outputDir, Format format, int width, int height, int fps,
+        int queueCapacity = 8, int threadCount = 0);
+    // Vide la file, attend les encodeurs et ferme les fichiers
+    void stop();
+
+    // Copie une frame RGBA dans un buffer libre et la place dans la file.
+    // flipY : la lecture d'une RenderTexture Raylib est inverse en Y.
+    bool submit(const unsigned char* rgba, int width, int height, bool flipY);
+
+    bool isRunning() const { return m_running; }
+    int framesWritten();
+    int stalls();
+    // Dbit soutenu (frames crites / seconde depuis le dmarrage)
+    float exportFPS();
+
+private:
+    struct Frame {
+        std::vector<unsigned char> rgba;
+        long index = 0;
+    };
+
+    void workerLoop();
+    bool writePNG(const Frame& frame);
+    void convertY4M(const Frame& frame, std::vector<unsigned char>& yuv) const;
+    bool writeY4M(const Frame& frame, const std::vector<unsigned char>& yuv);
+
+    bool m_running = false;
+    Format m_format = PNG;
+    std::string m_outputDir;
+    int m_width = 0;
+    int m_height = 0;
+    int m_fps = 60;
+
+    // Buffers de frames : libres / en attente d'encodage
+    std::vector<Frame> m_frames;
+    std::vector<Frame*> m_freeFrames;
+    std::deque<Frame*> m_queue;
+    bool m_stopRequested = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_queueCond;   // frame disponible pour les encodeurs
+    std::condition_variable m_freeCond;    // buffer libr pour la simulation
+    std::condition_variable m_orderCond;   // ordre d'criture du flux Y4M
+    std::vector<std::thread> m_workers;
+
+    // Flux Y4M (crit dans l'ordre des frames)
+    FILE* m_y4mFile = nullptr;
+    long m_nextToWrite = 0;
+
+    // Statistiques
+    long m_nextIndex = 0;
+    int m_written = 0;
+    int m_failed = 0;
+    int m_stalls = 0;
+    std::chrono::steady_clock::time_point m_startTime;
+};
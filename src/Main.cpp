@@ -1,5 +1,10 @@
 #include <QApplication>
 #include "MainWindow.h"
+#include "RaylibWidget.h"
+#include "BackendCheck.h"
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
 
 // Cette ligne exporte un symbole que le driver NVIDIA recherche au dmarrage.
 // Si elle est presente et vaut 1, l'application se lance sur la carte ddie.
@@ -14,6 +19,28 @@ extern "C" {
 
 
 int main(int argc, char* argv[]) {
+    // Mode vrification (sans fentre) : compare les backends CPU / GPU, code de sortie 0 si conformes
+    if (argc > 1 && std::strcmp(argv[1], "--check-backends") == 0) {
+        return runBackendCheck() ? 0 : 1;
+    }
+
+    // Export sans fentre : --export <dossier> [png|y4m] [frames] [particules], code de sortie 0 si toutes les frames sont crites
+    if (argc > 1 && std::strcmp(argv[1], "--export") == 0) {
+        int frameCount = argc > 4 ? std::atoi(argv[4]) : 600;
+        int particleCount = argc > 5 ? std::atoi(argv[5]) : 1000;
+        if (argc < 3 || frameCount <= 0 || particleCount < 0) {
+            fprintf(stderr, "Usage : %s --export <dossier> [png|y4m] [frames] [particules]\n", argv[0]);
+            return 2;
+        }
+        FrameExporter::Format format = (argc > 3 && std::strcmp(argv[3], "y4m") == 0) ? FrameExporter::Y4M : FrameExporter::PNG;
+
+        QApplication app(argc, argv);
+        RaylibWidget renderer;
+        renderer.resize(1280, 720);
+        renderer.setParticleCount(particleCount);
+        return renderer.exportHeadless(argv[2], format, frameCount) ? 0 : 1;
+    }
+
     // 1. Initialise le systme Qt
     QApplication app(argc, argv);
 
@@ -4,6 +4,9 @@
 #include <QGroupBox>
 #include <QPushButton>
 #include <QComboBox>
+#include <QFileDialog>
+#include <utility>
+#include <cmath>
 
 MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
     setWindowTitle("Simulateur Hybride (Qt + Raylib)");
@@ -65,6 +68,93 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
 
     controlsLayout->addWidget(grpCursor);
 
+    // Groupe Flux continu (metteur / puits)
+    QGroupBox* grpStream = new QGroupBox("Flux continu", this);
+    QVBoxLayout* layStream = new QVBoxLayout(grpStream);
+
+        // Emetteur
+    m_chkEmitterActive = new QCheckBox("metteur", this);
+    layStream->addWidget(m_chkEmitterActive);
+
+        // Dbit (particules / seconde), chelle logarithmique : 10^(valeur / 100), 0 = arrt, jusqu' ~3 M/s
+    m_lblEmitterRate = new QLabel("Dbit: 2000 /s", this);
+    m_sliderEmitterRate = new QSlider(Qt::Horizontal, this);
+    m_sliderEmitterRate->setRange(0, 650);
+    m_sliderEmitterRate->setValue(330);
+    layStream->addWidget(m_lblEmitterRate);
+    layStream->addWidget(m_sliderEmitterRate);
+
+        // Dure de vie (diximes de seconde)
+    m_lblEmitterLifetime = new QLabel("Dure de vie: 5.0 s", this);
+    m_sliderEmitterLifetime = new QSlider(Qt::Horizontal, this);
+    m_sliderEmitterLifetime->setRange(1, 200);
+    m_sliderEmitterLifetime->setValue(50);
+    layStream->addWidget(m_lblEmitterLifetime);
+    layStream->addWidget(m_sliderEmitterLifetime);
+
+        // Ouverture du cne d'mission
+    m_lblEmitterSpread = new QLabel("Cne: 20", this);
+    m_sliderEmitterSpread = new QSlider(Qt::Horizontal, this);
+    m_sliderEmitterSpread->setRange(0, 90);
+    m_sliderEmitterSpread->setValue(20);
+    layStream->addWidget(m_lblEmitterSpread);
+    layStream->addWidget(m_sliderEmitterSpread);
+
+        // Variation de la dure de vie (diximes de seconde)
+    m_lblEmitterLifetimeJitter = new QLabel("Variation dure: 1.0 s", this);
+    m_sliderEmitterLifetimeJitter = new QSlider(Qt::Horizontal, this);
+    m_sliderEmitterLifetimeJitter->setRange(0, 100);
+    m_sliderEmitterLifetimeJitter->setValue(10);
+    layStream->addWidget(m_lblEmitterLifetimeJitter);
+    layStream->addWidget(m_sliderEmitterLifetimeJitter);
+
+        // Direction de l'axe du cne (0 = droite, 90 = haut)
+    m_lblEmitterDirection = new QLabel("Direction: 57", this);
+    m_sliderEmitterDirection = new QSlider(Qt::Horizontal, this);
+    m_sliderEmitterDirection->setRange(0, 359);
+    m_sliderEmitterDirection->setValue(57);
+    layStream->addWidget(m_lblEmitterDirection);
+    layStream->addWidget(m_sliderEmitterDirection);
+
+        // Plage de vitesse initiale (px par pas)
+    m_lblEmitterSpeed = new QLabel("Vitesse: 6 - 12 px/pas", this);
+    m_sliderEmitterSpeedMin = new QSlider(Qt::Horizontal, this);
+    m_sliderEmitterSpeedMin->setRange(0, 40);
+    m_sliderEmitterSpeedMin->setValue(6);
+    m_sliderEmitterSpeedMax = new QSlider(Qt::Horizontal, this);
+    m_sliderEmitterSpeedMax->setRange(0, 40);
+    m_sliderEmitterSpeedMax->setValue(12);
+    layStream->addWidget(m_lblEmitterSpeed);
+    layStream->addWidget(m_sliderEmitterSpeedMin);
+    layStream->addWidget(m_sliderEmitterSpeedMax);
+
+        // Puits
+    m_chkSinkActive = new QCheckBox("Puits", this);
+    layStream->addWidget(m_chkSinkActive);
+
+    controlsLayout->addWidget(grpStream);
+
+    // Groupe Export
+    QGroupBox* grpExport = new QGroupBox("Export", this);
+    QVBoxLayout* layExport = new QVBoxLayout(grpExport);
+
+        // Format : squence PNG ou vido brute Y4M
+    m_comboExportFormat = new QComboBox(this);
+    m_comboExportFormat->addItem("PNG (squence)");
+    m_comboExportFormat->addItem("Y4M (vido brute)");
+    layExport->addWidget(m_comboExportFormat);
+
+        // Hors cran : la simulation n'est plus limite par l'affichage.
+        // Reste pilot par le rafrachissement du widget (s'arrte si la fentre est rduite) :
+        // pour un export sans fentre, utiliser "--export"
+    m_chkExportOffscreen = new QCheckBox("Rendu hors cran", this);
+    layExport->addWidget(m_chkExportOffscreen);
+
+    m_btnExport = new QPushButton("Dmarrer l'export", this);
+    layExport->addWidget(m_btnExport);
+
+    controlsLayout->addWidget(grpExport);
+
 
     // Groupe Physique
     QGroupBox* grpPhys = new QGroupBox("Physique et Paramtres", this);
@@ -166,6 +256,54 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
         if (m_renderWidget) m_renderWidget->setCursorRadius((float)val);
         });
 
+	// Flux continu
+    connect(m_chkEmitterActive, &QCheckBox::toggled, this, [this](bool checked) {
+        if (m_renderWidget) m_renderWidget->setEmitterActive(checked);
+        });
+
+    connect(m_sliderEmitterRate, &QSlider::valueChanged, this, [this](int val) {
+        int rate = val > 0 ? (int)std::lround(std::pow(10.0, val / 100.0)) : 0;
+        m_lblEmitterRate->setText(QString("Dbit: %1 /s").arg(rate));
+        if (m_renderWidget) m_renderWidget->setEmitterRate((float)rate);
+        });
+
+    connect(m_sliderEmitterLifetime, &QSlider::valueChanged, this, [this](int val) {
+        float seconds = val / 10.0f;
+        m_lblEmitterLifetime->setText(QString("Dure de vie: %1 s").arg(seconds, 0, 'f', 1));
+        if (m_renderWidget) m_renderWidget->setEmitterLifetime(seconds);
+        });
+
+    connect(m_sliderEmitterSpread, &QSlider::valueChanged, this, [this](int val) {
+        m_lblEmitterSpread->setText(QString("Cne: %1").arg(val));
+        if (m_renderWidget) m_renderWidget->setEmitterSpread((float)val);
+        });
+
+    connect(m_sliderEmitterLifetimeJitter, &QSlider::valueChanged, this, [this](int val) {
+        float seconds = val / 10.0f;
+        m_lblEmitterLifetimeJitter->setText(QString("Variation dure: %1 s").arg(seconds, 0, 'f', 1));
+        if (m_renderWidget) m_renderWidget->setEmitterLifetimeJitter(seconds);
+        });
+
+    connect(m_sliderEmitterDirection, &QSlider::valueChanged, this, [this](int val) {
+        m_lblEmitterDirection->setText(QString("Direction: %1").arg(val));
+        if (m_renderWidget) m_renderWidget->setEmitterDirection((float)val);
+        });
+
+    // Les deux bornes de vitesse partagent le mme label
+    auto updateEmitterSpeed = [this]() {
+        int minSpeed = m_sliderEmitterSpeedMin->value();
+        int maxSpeed = m_sliderEmitterSpeedMax->value();
+        if (maxSpeed < minSpeed) std::swap(minSpeed, maxSpeed);
+        m_lblEmitterSpeed->setText(QString("Vitesse: %1 - %2 px/pas").arg(minSpeed).arg(maxSpeed));
+        if (m_renderWidget) m_renderWidget->setEmitterSpeed((float)minSpeed, (float)maxSpeed);
+        };
+    connect(m_sliderEmitterSpeedMin, &QSlider::valueChanged, this, updateEmitterSpeed);
+    connect(m_sliderEmitterSpeedMax, &QSlider::valueChanged, this, updateEmitterSpeed);
+
+    connect(m_chkSinkActive, &QCheckBox::toggled, this, [this](bool checked) {
+        if (m_renderWidget) m_renderWidget->setSinkActive(checked);
+        });
+
 
 	// Mode de calcul CPU / GPU
     connect(m_comboComputeMode, &QComboBox::currentIndexChanged, this, [this](int index) {
@@ -178,6 +316,31 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent) {
         }
         });
 
+	// Export
+    connect(m_btnExport, &QPushButton::clicked, this, [this]() {
+        if (!m_renderWidget) return;
+
+        if (m_renderWidget->isExporting()) {
+            m_renderWidget->stopExport();
+            m_btnExport->setText("Dmarrer l'export");
+            return;
+        }
+
+        QString dir = QFileDialog::getExistingDirectory(this, "Dossier d'export");
+        if (dir.isEmpty()) return;
+
+        FrameExporter::Format format = (m_comboExportFormat->currentIndex() == 0)
+            ? FrameExporter::PNG
+            : FrameExporter::Y4M;
+        if (m_renderWidget->startExport(dir.toStdString(), format, m_chkExportOffscreen->isChecked())) {
+            m_btnExport->setText("Arrter l'export");
+        }
+        });
+
+    connect(m_renderWidget, &RaylibWidget::exportStopped, this, [this]() {
+        m_btnExport->setText("Dmarrer l'export");
+        });
+
 	// Physique Globale
     connect(m_sliderFriction, &QSlider::valueChanged, this, [this](int val) {
         float f = val / 100.0f;
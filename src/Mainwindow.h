@@ -58,4 +58,26 @@ private:
 	// Rayon d'Action Curseur
     QSlider* m_sliderCursorRadius;
     QLabel* m_lblCursorRadius;
+
+	// Flux continu
+    QCheckBox* m_chkEmitterActive;
+    QSlider* m_sliderEmitterRate;
+    QLabel* m_lblEmitterRate;
+    QSlider* m_sliderEmitterLifetime;
+    QLabel* m_lblEmitterLifetime;
+    QSlider* m_sliderEmitterSpread;
+    QLabel* m_lblEmitterSpread;
+    QSlider* m_sliderEmitterLifetimeJitter;
+    QLabel* m_lblEmitterLifetimeJitter;
+    QSlider* m_sliderEmitterDirection;
+    QLabel* m_lblEmitterDirection;
+    QSlider* m_sliderEmitterSpeedMin;
+    QSlider* m_sliderEmitterSpeedMax;
+    QLabel* m_lblEmitterSpeed;
+    QCheckBox* m_chkSinkActive;
+
+	// Export des frames
+    QComboBox* m_comboExportFormat;
+    QCheckBox* m_chkExportOffscreen;
+    QPushButton* m_btnExport;
 };
\ No newline at end of file
@@ -1,9 +1,13 @@
 #pragma once
 #include <raylib.h>
 
+// Dure de vie infinie (particules cres par initParticles / setParticleCount)
+constexpr float PARTICLE_IMMORTAL = 1.0e30f;
+
 struct Particle {
     Vector2 position;
     Vector2 velocity;
     float radius;
     Color color;
+    float life;      // secondes restantes, PARTICLE_IMMORTAL = jamais dtruite
 };
\ No newline at end of file
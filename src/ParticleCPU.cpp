@@ -0,0 +1,86 @@
+#include "ParticleCPU.h"
+#include "ParticlePhysics.h"
+#include <cmath>
+
+// Au-del, les collisions inter-particules O(N^2) sont trop lourdes pour le CPU
+static const int CPU_COLLISION_LIMIT = 2000;
+
+// Collision entre deux particules de mme masse. Renvoie true si elles se chevauchaient.
+static bool resolveCollision(Vector2& p1, Vector2& v1, Vector2& p2, Vector2& v2, float minDistance, float rebound) {
+    float dx = p2.x - p1.x;
+    float dy = p2.y - p1.y;
+    float distance = std::sqrt(dx * dx + dy * dy);
+
+    // Pas de collision
+    if (distance >= minDistance || distance <= 0.0001f) return false;
+
+    // 1. Calcul de la normale et de la tangente
+    float nx = dx / distance;
+    float ny = dy / distance;
+
+    // 2. Sparation des particules (pour ne pas qu'elles s'agglutinent)
+    float overlap = minDistance - distance;
+    float moveX = nx * overlap * 0.5f;
+    float moveY = ny * overlap * 0.5f;
+
+    p1.x -= moveX;
+    p1.y -= moveY;
+    p2.x += moveX;
+    p2.y += moveY;
+
+    // 3. Rponse lastique (Echange d'impulsion)
+    // Vitesse relative
+    float dvx = v2.x - v1.x;
+    float dvy = v2.y - v1.y;
+
+    // Produit scalaire vitesse relative . normale
+    float dotProduct = dvx * nx + dvy * ny;
+
+    // Si les particules s'loignent dj, on ne fait rien
+    if (dotProduct > 0) return true;
+
+    // Calcul de l'impulsion scalaire
+    float impulseScale = -(1.0f + rebound) * dotProduct;
+
+    // On divise par la somme des masses inverses (ici masse = 1 pour tout le monde)
+    impulseScale /= 2.0f;
+
+    // Application de l'impulsion
+    float impulseX = nx * impulseScale;
+    float impulseY = ny * impulseScale;
+
+    v1.x -= impulseX;
+    v1.y -= impulseY;
+    v2.x += impulseX;
+    v2.y += impulseY;
+    return true;
+}
+
+int updateParticlesCPU(Particle* particles, int count, float dt, float gravity, float friction, float rebound, int width, int height,
+    float mouseX, float mouseY, float cursorStrength, float cursorRadius, bool cursorActive, const Sink* sinks, int sinkCount) {
+
+    // --- A. INTEGRATION + VIEILLISSEMENT ---
+    // Compaction en place : "alive" est la somme prfixe des particules vivantes,
+    // chaque survivante est recopie  cet index (ordre conserv, aucune allocation)
+    int alive = 0;
+    for (int i = 0; i < count; i++) {
+        Particle p = particles[i];
+        integrateParticle(p.position, p.velocity, p.radius, dt, gravity, friction, rebound, width, height,
+            mouseX, mouseY, cursorStrength, cursorRadius, cursorActive);
+        if (ageParticle(p.life, p.position, dt, sinks, sinkCount)) {
+            particles[alive++] = p;
+        }
+    }
+    count = alive;
+
+    // --- B. BOUCLE DE COLLISION INTER-PARTICULES (Nave O(N^2)) ---
+    if (count > CPU_COLLISION_LIMIT) return count;
+    for (int i = 0; i < count; i++) {
+        for (int j = i + 1; j < count; j++) {
+            Particle& p1 = particles[i];
+            Particle& p2 = particles[j];
+            resolveCollision(p1.position, p1.velocity, p2.position, p2.velocity, p1.radius + p2.radius, rebound);
+        }
+    }
+    return count;
+}
@@ -0,0 +1,7 @@
+#pragma once
+#include "Particle.h"
+#include "ParticleStream.h"
+
+// Equivalent CPU de updateParticlesCUDA (mmes paramtres, mme valeur de retour)
+int updateParticlesCPU(Particle* particles, int count, float dt, float gravity, float friction, float rebound, int width, int height,
+    float mouseX, float mouseY, float cursorStrength, float cursorRadius, bool cursorActive, const Sink* sinks, int sinkCount);
\ No newline at end of file
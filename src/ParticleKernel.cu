@@ -1,8 +1,10 @@
 #include "ParticleKernel.h"
+#include "ParticlePhysics.h"
 #include <cuda_runtime.h>
 #include <device_launch_parameters.h>
 #include <cstdio>
 #include <cmath> // Pour sqrtf
+#include <utility>
 
 #define gpuErrchk(ans) { gpuAssert((ans), __FILE__, __LINE__); }
 inline void gpuAssert(cudaError_t code, const char* file, int line, bool abort = true) {
@@ -11,124 +13,274 @@ inline void gpuAssert(cudaError_t code, const char* file, int line, bool abort =
     }
 }
 
-// Kernel CUDA mis  jour avec interaction souris
-__global__ void updateParticlesKernel(Particle* particles, int count, float dt, float gravity, float friction, float rebound, int width, int height,
-    float mouseX, float mouseY, float cursorStrength, float cursorRadius, bool cursorActive) {
+// Prsence d'un GPU CUDA utilisable
+bool isCudaAvailable() {
+    int deviceCount = 0;
+    if (cudaGetDeviceCount(&deviceCount) != cudaSuccess) return false;
+    return deviceCount > 0;
+}
+
+// Puits transmis par valeur aux kernels
+struct SinkList {
+    Sink sinks[MAX_SINKS];
+    int count;
+};
+
+static SinkList makeSinkList(const Sink* sinks, int sinkCount) {
+    SinkList list;
+    list.count = sinkCount < MAX_SINKS ? sinkCount : MAX_SINKS;
+    for (int k = 0; k < list.count; k++) list.sinks[k] = sinks[k];
+    return list;
+}
+
+// Buffers GPU persistants : rallous seulement quand la taille demande augmente
+enum DeviceBufferSlot {
+    BUFFER_PARTICLES,
+    BUFFER_RESULT,
+    BUFFER_FLAGS,
+    BUFFER_CONTACTS,
+    BUFFER_OFFSETS,
+    BUFFER_BLOCK_SUMS,
+    BUFFER_COUNT};
+
+static void* deviceBuffer(DeviceBufferSlot slot, size_t size) {
+    static void* buffers[BUFFER_COUNT] = {};
+    static size_t capacities[BUFFER_COUNT] = {};
+
+    if (size > capacities[slot]) {
+        if (buffers[slot]) gpuErrchk(cudaFree(buffers[slot]));
+        gpuErrchk(cudaMalloc(&buffers[slot], size));
+        capacities[slot] = size;
+    }
+    return buffers[slot];
+}
+
+// Taille de bloc commune aux kernels (le scan et la dispersion doivent dcouper pareil)
+const int THREADS_PER_BLOCK = 256;
+
+// Passes de relaxation des collisions par pas (la rsolution parallle converge moins vite
+// que la rsolution squentielle du CPU : deux passes divisent par deux l'cart d'nergie des tas)
+const int COLLISION_ITERATIONS = 2;
+
+// Au-del, les collisions inter-particules O(N^2) ne tiennent plus un pas par frame (flux de millions
+// de particules) : seules l'intgration, le vieillissement et la compaction sont excuts
+const int GPU_COLLISION_LIMIT = 16384;
+
+__device__ inline bool inContact(Vector2 pos, Vector2 otherPos, float minDist) {
+    float dx = pos.x - otherPos.x;
+    float dy = pos.y - otherPos.y;
+    float distSq = dx * dx + dy * dy;
+    return distSq < minDist * minDist && distSq > 0.0001f;
+}
+
+// Collision vue depuis la particule i : correction de position et impulsion appliques  i seulement,
+// pondres par "weight". La paire (i, j) lit le mme tat d'entre des deux cts : avec le mme
+// poids, j reoit exactement l'oppos et la quantit de mouvement est conserve.
+__device__ inline void accumulateCollision(Vector2 pos, Vector2 vel, Vector2 otherPos, Vector2 otherVel, float minDist, float rebound,
+    float weight, Vector2& dPos, Vector2& dVel) {
+
+    float dx = pos.x - otherPos.x;
+    float dy = pos.y - otherPos.y;
+    float dist = sqrtf(dx * dx + dy * dy);
+    float nx = dx / dist;
+    float ny = dy / dist;
+    float overlap = minDist - dist;
+
+    dPos.x += nx * overlap * 0.5f * weight;
+    dPos.y += ny * overlap * 0.5f * weight;
+
+    float dvx = vel.x - otherVel.x;
+    float dvy = vel.y - otherVel.y;
+    float dot = dvx * nx + dvy * ny;
+
+    if (dot < 0) {
+        float impulse = -(1.0f + rebound) * dot * 0.5f * weight;
+        dVel.x += impulse * nx;
+        dVel.y += impulse * ny;
+    }
+}
+
+// Poids d'une paire : additionner toutes les corrections d'un mme tat d'entre fait diverger
+// les tas denses, on les relaxe par 1 / max(contacts_i, contacts_j) (identique des deux cts)
+__device__ inline float pairWeight(int contactsI, int contactsJ) {
+    int contacts = contactsI > contactsJ ? contactsI : contactsJ;
+    return 1.0f / (float)contacts;
+}
+
+// Nombre de contacts de chaque particule vivante (premier passage de la rsolution).
+// Passage spar : le poids d'une paire dpend des contacts des deux particules pour le mme tat
+// d'entre, connus seulement une fois tous les contacts compts. Rutiliser les comptes de la passe
+// prcdente (fusion dans collideParticlesKernel) pondrerait avec un tat prim. Ce passage ne fait
+// qu'un test de distance par paire (ni racine ni criture de vitesse) et collideParticlesKernel saute
+// la boucle pour les particules sans contact.
+__global__ void countContactsKernel(const Particle* in, const int* flags, int* contacts, int count) {
 
     int i = blockIdx.x * blockDim.x + threadIdx.x;
     if (i >= count) return;
 
-    Particle p = particles[i];
+    Particle p = in[i];
+    int n = 0;
+    for (int j = 0; j < count; j++) {
+        if (i == j || !flags[j]) continue;
+        if (inContact(p.position, in[j].position, p.radius + in[j].radius)) n++;
+    }
+    contacts[i] = n;
+}
 
-    // INTERACTION SOURIS (Portage du code CPU vers GPU
-    if (cursorActive) {
-        float dx = mouseX - p.position.x;
-        float dy = mouseY - p.position.y;
+// Kernel d'intgration (souris, gravit, friction, murs) + vieillissement : flags[i] = 1 si vivante
+__global__ void updateParticlesKernel(Particle* particles, int* flags, int count, float dt, float gravity, float friction, float rebound, int width, int height,
+    float mouseX, float mouseY, float cursorStrength, float cursorRadius, bool cursorActive, SinkList sinks) {
 
-        // distance au carr pour viter sqrtf inutile
-        float distSq = dx * dx + dy * dy;
-        float radiusSq = cursorRadius * cursorRadius;
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= count) return;
 
-        // Si on est dans le cercle
-        if (distSq < radiusSq && distSq > 1.0f) {
-            float dist = sqrtf(distSq);
+    Particle p = particles[i];
+    integrateParticle(p.position, p.velocity, p.radius, dt, gravity, friction, rebound, width, height,
+        mouseX, mouseY, cursorStrength, cursorRadius, cursorActive);
+    flags[i] = ageParticle(p.life, p.position, dt, sinks.sinks, sinks.count) ? 1 : 0;
+    particles[i] = p;
+}
 
-            // Normalisation
-            float nx = dx / dist;
-            float ny = dy / dist;
+// Kernel de collisions entre particules : lit "in", crit "out" (pas de lecture d'un voisin en cours d'criture)
+__global__ void collideParticlesKernel(const Particle* in, Particle* out, const int* flags, const int* contacts, int count, float rebound) {
+
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= count) return;
 
-            // Facteur linaire (1 au centre, 0 au bord)
-            float forceFactor = (1.0f - (dist / cursorRadius));
+    Particle p = in[i];
+    Vector2 dPos = { 0.0f, 0.0f };
+    Vector2 dVel = { 0.0f, 0.0f };
 
-            // Application de la force
-            p.velocity.x += nx * forceFactor * cursorStrength * 2.0f;
-            p.velocity.y += ny * forceFactor * cursorStrength * 2.0f;
+    if (contacts[i] > 0) {
+        for (int j = 0; j < count; j++) {
+            if (i == j || !flags[j]) continue;
+            Particle other = in[j];
+            float minDist = p.radius + other.radius;
+            if (!inContact(p.position, other.position, minDist)) continue;
+            accumulateCollision(p.position, p.velocity, other.position, other.velocity, minDist, rebound,
+                pairWeight(contacts[i], contacts[j]), dPos, dVel);
         }
     }
 
-    // ---  PHYSIQUE CLASSIQUE ---
-	// Gravit
-    p.velocity.y += gravity * dt * 10.0f;
+    p.position.x += dPos.x;
+    p.position.y += dPos.y;
+    p.velocity.x += dVel.x;
+    p.velocity.y += dVel.y;
+    out[i] = p;
+}
 
-	// Friction
-    float damping = 1.0f - (friction * dt * 2.0f);
-    if (damping < 0) damping = 0;
-    p.velocity.x *= damping;
-    p.velocity.y *= damping;
+// --- COMPACTION (somme prfixe des drapeaux puis dispersion) ---
 
-	// Mise  jour position
-    p.position.x += p.velocity.x;
-    p.position.y += p.velocity.y;
+// Scan exclusif des drapeaux  l'intrieur de chaque bloc, total du bloc dans blockSums
+__global__ void scanBlocksKernel(const int* flags, int* offsets, int* blockSums, int count) {
+    __shared__ int temp[THREADS_PER_BLOCK];
 
-    // ---  COLLISIONS MURS ---
-    if (p.position.y > height - p.radius) {
-        p.position.y = height - p.radius;
-        p.velocity.y *= -rebound;
-    }
-    if (p.position.y < p.radius) {
-        p.position.y = p.radius;
-        p.velocity.y *= -rebound;
-    }
-    if (p.position.x > width - p.radius || p.position.x < p.radius) {
-        p.velocity.x *= -rebound;
-        if (p.position.x > width - p.radius) p.position.x = width - p.radius;
-        if (p.position.x < p.radius) p.position.x = p.radius;
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    int value = (i < count) ? flags[i] : 0;
+    temp[threadIdx.x] = value;
+    __syncthreads();
+
+    // Scan inclusif (Hillis-Steele)
+    for (int offset = 1; offset < THREADS_PER_BLOCK; offset <<= 1) {
+        int add = (threadIdx.x >= offset) ? temp[threadIdx.x - offset] : 0;
+        __syncthreads();
+        temp[threadIdx.x] += add;
+        __syncthreads();
     }
 
-    // ---  COLLISIONS ENTRE PARTICULES ---
-    for (int j = 0; j < count; j++) {
-        if (i == j) continue;
-        Particle other = particles[j];
-        float dx = p.position.x - other.position.x;
-        float dy = p.position.y - other.position.y;
-        float distSq = dx * dx + dy * dy;
-        float minDist = p.radius + other.radius;
-
-        if (distSq < minDist * minDist && distSq > 0.0001f) {
-            float dist = sqrtf(distSq);
-            float nx = dx / dist;
-            float ny = dy / dist;
-            float overlap = minDist - dist;
-
-            p.position.x += nx * overlap * 0.5f;
-            p.position.y += ny * overlap * 0.5f;
-
-            float dvx = p.velocity.x - other.velocity.x;
-            float dvy = p.velocity.y - other.velocity.y;
-            float dot = dvx * nx + dvy * ny;
-
-            if (dot < 0) {
-                float impulse = -(1.0f + rebound) * dot * 0.5f;
-                p.velocity.x += impulse * nx;
-                p.velocity.y += impulse * ny;
-            }
+    if (i < count) offsets[i] = temp[threadIdx.x] - value;
+    if (threadIdx.x == THREADS_PER_BLOCK - 1) blockSums[blockIdx.x] = temp[threadIdx.x];
+}
+
+// Scan exclusif des totaux de blocs (un seul bloc, par tranches), nombre de survivantes dans blockSums[blockCount]
+__global__ void scanBlockSumsKernel(int* blockSums, int blockCount) {
+    __shared__ int temp[THREADS_PER_BLOCK];
+    __shared__ int carry;
+
+    if (threadIdx.x == 0) carry = 0;
+    __syncthreads();
+
+    for (int base = 0; base < blockCount; base += THREADS_PER_BLOCK) {
+        int i = base + threadIdx.x;
+        int value = (i < blockCount) ? blockSums[i] : 0;
+        temp[threadIdx.x] = value;
+        __syncthreads();
+
+        for (int offset = 1; offset < THREADS_PER_BLOCK; offset <<= 1) {
+            int add = (threadIdx.x >= offset) ? temp[threadIdx.x - offset] : 0;
+            __syncthreads();
+            temp[threadIdx.x] += add;
+            __syncthreads();
         }
+
+        if (i < blockCount) blockSums[i] = carry + temp[threadIdx.x] - value;
+        __syncthreads();
+        if (threadIdx.x == THREADS_PER_BLOCK - 1) carry += temp[threadIdx.x];
+        __syncthreads();
     }
 
-    particles[i] = p;
+    if (threadIdx.x == 0) blockSums[blockCount] = carry;
+}
+
+// Chaque survivante est recopie  son rang (ordre conserv)
+__global__ void scatterAliveKernel(const Particle* in, Particle* out, const int* flags, const int* offsets, const int* blockSums, int count) {
+    int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= count || !flags[i]) return;
+    out[blockSums[blockIdx.x] + offsets[i]] = in[i];
 }
 
-// Wrapper mis  jour
-void updateParticlesCUDA(Particle* particles, int count, float dt, float gravity, float friction, float rebound, int width, int height,
-    float mouseX, float mouseY, float cursorStrength, float cursorRadius, bool cursorActive) {
+// Compacte "in" vers "out" selon les drapeaux, renvoie le nombre de survivantes
+static int compactAlive(const Particle* in, Particle* out, const int* flags, int count) {
+    int blocksPerGrid = (count + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
+    int* d_offsets = (int*)deviceBuffer(BUFFER_OFFSETS, count * sizeof(int));
+    int* d_blockSums = (int*)deviceBuffer(BUFFER_BLOCK_SUMS, (blocksPerGrid + 1) * sizeof(int));
 
-    Particle* d_particles = nullptr;
+    scanBlocksKernel << <blocksPerGrid, THREADS_PER_BLOCK >> > (flags, d_offsets, d_blockSums, count);
+    scanBlockSumsKernel << <1, THREADS_PER_BLOCK >> > (d_blockSums, blocksPerGrid);
+    scatterAliveKernel << <blocksPerGrid, THREADS_PER_BLOCK >> > (in, out, flags, d_offsets, d_blockSums, count);
+
+    int alive = 0;
+    gpuErrchk(cudaMemcpy(&alive, d_blockSums + blocksPerGrid, sizeof(int), cudaMemcpyDeviceToHost));
+    return alive;
+}
+
+// Wrapper mis  jour : renvoie le nombre de particules vivantes, compactes en tte de "particles"
+int updateParticlesCUDA(Particle* particles, int count, float dt, float gravity, float friction, float rebound, int width, int height,
+    float mouseX, float mouseY, float cursorStrength, float cursorRadius, bool cursorActive, const Sink* sinks, int sinkCount) {
+
+    if (count <= 0) return 0;
     size_t size = count * sizeof(Particle);
 
-    gpuErrchk(cudaMalloc(&d_particles, size));
+    Particle* d_particles = (Particle*)deviceBuffer(BUFFER_PARTICLES, size);
+    Particle* d_result = (Particle*)deviceBuffer(BUFFER_RESULT, size);
+    int* d_flags = (int*)deviceBuffer(BUFFER_FLAGS, count * sizeof(int));
+    int* d_contacts = (int*)deviceBuffer(BUFFER_CONTACTS, count * sizeof(int));
     gpuErrchk(cudaMemcpy(d_particles, particles, size, cudaMemcpyHostToDevice));
 
-    int threadsPerBlock = 256;
-    int blocksPerGrid = (count + threadsPerBlock - 1) / threadsPerBlock;
+    int blocksPerGrid = (count + THREADS_PER_BLOCK - 1) / THREADS_PER_BLOCK;
 
     // On passe TOUS les nouveaux arguments au Kernel
-    updateParticlesKernel << <blocksPerGrid, threadsPerBlock >> > (
-        d_particles, count, dt, gravity, friction, rebound, width, height,
-        mouseX, mouseY, cursorStrength, cursorRadius, cursorActive
+    updateParticlesKernel << <blocksPerGrid, THREADS_PER_BLOCK >> > (
+        d_particles, d_flags, count, dt, gravity, friction, rebound, width, height,
+        mouseX, mouseY, cursorStrength, cursorRadius, cursorActive, makeSinkList(sinks, sinkCount)
         );
 
+    // Collisions : alternance entre les deux buffers  chaque passe
+    Particle* d_current = d_particles;
+    Particle* d_next = d_result;
+    int collisionIterations = count > GPU_COLLISION_LIMIT ? 0 : COLLISION_ITERATIONS;
+    for (int k = 0; k < collisionIterations; k++) {
+        countContactsKernel << <blocksPerGrid, THREADS_PER_BLOCK >> > (d_current, d_flags, d_contacts, count);
+        collideParticlesKernel << <blocksPerGrid, THREADS_PER_BLOCK >> > (d_current, d_next, d_flags, d_contacts, count, rebound);
+        std::swap(d_current, d_next);
+    }
+
+    // Compaction des survivantes dans l'autre buffer
+    int alive = compactAlive(d_current, d_next, d_flags, count);
+
     gpuErrchk(cudaPeekAtLastError());
     gpuErrchk(cudaDeviceSynchronize());
-    gpuErrchk(cudaMemcpy(particles, d_particles, size, cudaMemcpyDeviceToHost));
-    gpuErrchk(cudaFree(d_particles));
-}
\ No newline at end of file
+    gpuErrchk(cudaMemcpy(particles, d_next, alive * sizeof(Particle), cudaMemcpyDeviceToHost));
+    return alive;
+}
+
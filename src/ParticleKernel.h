@@ -1,6 +1,12 @@
 #pragma once
 #include "Particle.h"
+#include "ParticleStream.h"
+
+// Renvoie false si aucun GPU CUDA n'est disponible
+bool isCudaAvailable();
 
 // Fonction CUDA pour mettre  jour les particules
-void updateParticlesCUDA(Particle* particles, int count, float dt, float gravity, float friction, float rebound, int width, int height,
-    float mouseX, float mouseY, float cursorStrength, float cursorRadius, bool cursorActive);
\ No newline at end of file
+// Les particules mortes (dure de vie coule ou puits) sont retires : les survivantes sont
+// compactes en tte du tableau, dans leur ordre, et leur nombre est renvoy.
+int updateParticlesCUDA(Particle* particles, int count, float dt, float gravity, float friction, float rebound, int width, int height,
+    float mouseX, float mouseY, float cursorStrength, float cursorRadius, bool cursorActive, const Sink* sinks, int sinkCount);
\ No newline at end of file
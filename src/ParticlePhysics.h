@@ -0,0 +1,90 @@
+#pragma once
+#include "Particle.h"
+#include "ParticleStream.h"
+#include <cmath>
+
+#ifdef __CUDACC__
+#define PARTICLE_HD __host__ __device__
+#else
+#define PARTICLE_HD
+#endif
+
+// Pas de temps fixe de la simulation (un pas par frame, 60 pas par seconde simule)
+constexpr float SIMULATION_DT = 1.0f / 60.0f;
+
+// Intgration d'une particule (souris, gravit, friction, murs)
+// Partage par le CPU et les kernels CUDA pour que les backends restent identiques
+PARTICLE_HD inline void integrateParticle(Vector2& position, Vector2& velocity, float radius, float dt, float gravity, float friction, float rebound, int width, int height,
+    float mouseX, float mouseY, float cursorStrength, float cursorRadius, bool cursorActive) {
+
+    // INTERACTION SOURIS
+    if (cursorActive) {
+        float dx = mouseX - position.x;
+        float dy = mouseY - position.y;
+
+        // distance au carr pour viter sqrtf inutile
+        float distSq = dx * dx + dy * dy;
+        float radiusSq = cursorRadius * cursorRadius;
+
+        // Si on est dans le cercle
+        if (distSq < radiusSq && distSq > 1.0f) {
+            float dist = sqrtf(distSq);
+
+            // Normalisation
+            float nx = dx / dist;
+            float ny = dy / dist;
+
+            // Facteur linaire (1 au centre, 0 au bord)
+            float forceFactor = (1.0f - (dist / cursorRadius));
+
+            // Application de la force (positif = attraction, ngatif = rpulsion)
+            velocity.x += nx * forceFactor * cursorStrength * 2.0f;
+            velocity.y += ny * forceFactor * cursorStrength * 2.0f;
+        }
+    }
+
+    // Gravit
+    velocity.y += gravity * dt * 10.0f;
+
+    // Friction
+    float damping = 1.0f - (friction * dt * 2.0f);
+    if (damping < 0) damping = 0;
+    velocity.x *= damping;
+    velocity.y *= damping;
+
+    // Mise  jour position (une seule fois par pas)
+    position.x += velocity.x;
+    position.y += velocity.y;
+
+    // Collisions murs
+    if (position.y > height - radius) {
+        position.y = height - radius;
+        velocity.y *= -rebound;
+    }
+    if (position.y < radius) {
+        position.y = radius;
+        velocity.y *= -rebound;
+    }
+    if (position.x > width - radius || position.x < radius) {
+        velocity.x *= -rebound;
+        if (position.x > width - radius) position.x = width - radius;
+        if (position.x < radius) position.x = radius;
+    }
+}
+
+// Vrai si la position est dans l'un des puits
+PARTICLE_HD inline bool insideSink(Vector2 position, const Sink* sinks, int sinkCount) {
+    for (int k = 0; k < sinkCount; k++) {
+        float dx = position.x - sinks[k].position.x;
+        float dy = position.y - sinks[k].position.y;
+        if (dx * dx + dy * dy < sinks[k].radius * sinks[k].radius) return true;
+    }
+    return false;
+}
+
+// Vieillissement d'un pas. Renvoie false si la particule meurt (dure de vie coule ou puits).
+// La dure restante dcrot de dt, la particule meurt  0.
+PARTICLE_HD inline bool ageParticle(float& life, Vector2 position, float dt, const Sink* sinks, int sinkCount) {
+    life -= dt;
+    return life > 0.0f && !insideSink(position, sinks, sinkCount);
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "Particle.h"
+
+// Nombre maximal de puits transmis aux kernels
+constexpr int MAX_SINKS = 8;
+
+// Puits : toute particule qui y entre est dtruite
+struct Sink {
+    Vector2 position;
+    float radius;
+};
+
+// Emetteur : flux continu de particules dans un cne
+struct Emitter {
+    Vector2 position;
+    float rate;            // particules par seconde
+    float direction;       // axe du cne (radians, 0 = vers la droite)
+    float spread;          // demi-angle du cne (radians)
+    float speedMin;        // vitesse initiale (px par pas), tire uniformment
+    float speedMax;
+    float lifetime;        // dure de vie moyenne (secondes)
+    float lifetimeJitter;  // variation alatoire de la dure de vie (+/- secondes)
+    float accumulator;     // fraction de particule reporte au pas suivant
+};
@@ -4,7 +4,20 @@
 #include <random>
 #include <QResizeEvent>
 #include <cmath>
+#include <cstdio>
+#include <utility>
+#include <algorithm>
 #include "ParticleKernel.h"
+#include "ParticleCPU.h"
+#include "ParticlePhysics.h"
+
+// Au-del, un cercle par particule (DrawCircleV : 36 triangles) sature le lot de raylib :
+// les particules sont crites comme points dans une texture envoye en une seule fois
+static const int POINT_RENDER_THRESHOLD = 20000;
+
+// Capacit du stockage : plancher, et plafond mmoire du flux (4 M x 32 octets, doubl ct GPU)
+static const int MIN_CAPACITY = 200000;
+static const int MAX_CAPACITY = 4000000;
 
 RaylibWidget::RaylibWidget(QWidget* parent) : QWidget(parent) {
     // Optimisation : On indique  Qt qu'on dessine tout le fond nous-mmes
@@ -13,11 +26,15 @@ RaylibWidget::RaylibWidget(QWidget* parent) : QWidget(parent) {
 
     // IMPORTANT : Permet de recevoir les mouvements de souris mme sans cliquer
     setMouseTracking(true);
+
+    m_streamStatsTime = std::chrono::steady_clock::now();
 }
 
 RaylibWidget::~RaylibWidget() {
+    m_exporter.stop();
     if (m_isInitialized) {
         UnloadRenderTexture(m_renderTexture);
+        UnloadTexture(m_pointsTexture);
         CloseWindow();
     }
 }
@@ -38,6 +55,7 @@ void RaylibWidget::initRaylib() {
     SetConfigFlags(FLAG_WINDOW_HIDDEN);
     InitWindow(width(), height(), "Raylib Renderer");
     m_renderTexture = LoadRenderTexture(width(), height());
+    loadPointsTexture();
     m_isInitialized = true;
     initParticles();
 }
@@ -56,171 +74,89 @@ void RaylibWidget::setGravity(float g) {
 
 void RaylibWidget::initParticles() {
     m_particles.clear();
+    reserveCapacity();
     for (int i = 0; i < m_targetCount; i++) {
-        Particle p;
-        p.position = { (float)GetRandomValue(0, width()), (float)GetRandomValue(0, height()) };
-
-        float vx = (float)GetRandomValue(-100, 100) / 10.0f;
-        float vy = (float)GetRandomValue(-100, 100) / 10.0f;
-        p.velocity = { vx * m_velocityScale, vy * m_velocityScale };
-
-        p.radius = m_particleRadius;
-        p.color = { (unsigned char)GetRandomValue(50, 255), (unsigned char)GetRandomValue(50, 255), 255, 255 };
-        m_particles.push_back(p);
+        m_particles.push_back(makeRandomParticle());
     }
 }
 
-void RaylibWidget::updatePhysics() {
-    if (m_isPaused) return;
-
-    if (m_computeMode == CPU) {
-
+// Gnre une particule alatoire dans la fentre
+Particle RaylibWidget::makeRandomParticle() {
+    Particle p;
+    p.position = { (float)GetRandomValue(0, width()), (float)GetRandomValue(0, height()) };
 
-        // Delta Time fixe pour la simulation
-        float dt = 1.0f / 60.0f;
+    float vx = (float)GetRandomValue(-100, 100) / 10.0f;
+    float vy = (float)GetRandomValue(-100, 100) / 10.0f;
+    p.velocity = { vx * m_velocityScale, vy * m_velocityScale };
 
-        for (auto& p : m_particles) {
-            p.velocity.y += m_gravity * dt * 10.0f;
-            p.position.x += p.velocity.x;
-            p.position.y += p.velocity.y;
-
-        // --- INTERACTION CURSEUR ---
-        if (m_cursorActive) {
-            float dx = m_mousePos.x - p.position.x;
-            float dy = m_mousePos.y - p.position.y;
-            float distSq = dx * dx + dy * dy; // Distance au carr (plus rapide)
-            float dist = std::sqrt(distSq);
-
-            // Si la particule est dans le rayon d'action
-            if (dist < m_cursorEffectRadius && dist > 1.0f) {
-                float nx = dx / dist; // Vecteur normalis
-                float ny = dy / dist;
-
-                // Force progressive : plus forte au centre (1.0) et nulle au bord (0.0)
-                float forceFactor = (1.0f - (dist / m_cursorEffectRadius));
-
-                // Application de la force (Force * Facteur * Puissance arbitraire)
-                // Strength positif = Attraction, Ngatif = Rpulsion
-                p.velocity.x += nx * forceFactor * m_cursorEffectStrength * 2.0f;
-                p.velocity.y += ny * forceFactor * m_cursorEffectStrength * 2.0f;
-            }
-        }
-        // ---------------------------
-
-        // 2. Friction
-        float damping = 1.0f - (m_friction * dt * 2.0f);
-        if (damping < 0) damping = 0;
-
-            p.velocity.x *= damping;
-            p.velocity.y *= damping;
-
-            // 3. Application du mouvement
-            p.position.x += p.velocity.x;
-            p.position.y += p.velocity.y;
+    p.radius = m_particleRadius;
+    p.color = { (unsigned char)GetRandomValue(50, 255), (unsigned char)GetRandomValue(50, 255), 255, 255 };
+    p.life = PARTICLE_IMMORTAL;
+    return p;
+}
 
-            // 4. Collisions Murs (Avec m_rebond)
-            // Bas
-            if (p.position.y > height() - p.radius) {
-                p.position.y = height() - p.radius;
-                p.velocity.y *= -m_rebond; // Rebond dynamique
-            }
-            // Haut
-            if (p.position.y < p.radius) {
-                p.position.y = p.radius;
-                p.velocity.y *= -m_rebond;
-            }
-            // Gauche / Droite
-            if (p.position.x > width() - p.radius || p.position.x < p.radius) {
-                p.velocity.x *= -m_rebond;
+// Rserve la capacit du stockage : permanentes + flux en rgime tabli (dbit x dure de vie maximale,
+// marge de 25 %). L'mission et la compaction n'allouent plus ensuite, seul un rglage peut l'agrandir.
+void RaylibWidget::reserveCapacity() {
+    double streamCount = (double)m_emitter.rate * (m_emitter.lifetime + m_emitter.lifetimeJitter) * 1.25;
+    double capacity = std::min(m_targetCount + streamCount, (double)MAX_CAPACITY);
+    capacity = std::max({ capacity, (double)MIN_CAPACITY, (double)m_targetCount });
+    if ((int)capacity > m_capacity) m_capacity = (int)capacity;
+    m_particles.reserve(m_capacity);
+}
 
-                // Correction de position
-                if (p.position.x > width() - p.radius) p.position.x = width() - p.radius;
-                if (p.position.x < p.radius) p.position.x = p.radius;
-            }
-        }
+void RaylibWidget::updatePhysics() {
+    if (m_isPaused) return;
 
-        // --- B. BOUCLE DE COLLISION INTER-PARTICULES (Nave O(N^2)) ---
-        // Note : C'est trs lourd pour le CPU.
-		if (m_particles.size() > 2000) return; // On vite les collisions si trop de particules
-        for (size_t i = 0; i < m_particles.size(); i++) {
-            for (size_t j = i + 1; j < m_particles.size(); j++) {
-                Particle& p1 = m_particles[i];
-                Particle& p2 = m_particles[j];
-
-                float dx = p2.position.x - p1.position.x;
-                float dy = p2.position.y - p1.position.y;
-                float distance = std::sqrt(dx * dx + dy * dy);
-                float minDistance = p1.radius + p2.radius;
-
-                // Si collision dtecte
-                if (distance < minDistance && distance > 0.0001f) {
-                    // 1. Calcul de la normale et de la tangente
-                    float nx = dx / distance;
-                    float ny = dy / distance;
-
-                    // 2. Sparation des particules (pour ne pas qu'elles s'agglutinent)
-                    float overlap = minDistance - distance;
-                    float moveX = nx * overlap * 0.5f;
-                    float moveY = ny * overlap * 0.5f;
-
-                    p1.position.x -= moveX;
-                    p1.position.y -= moveY;
-                    p2.position.x += moveX;
-                    p2.position.y += moveY;
-
-                    // 3. Rponse lastique (Echange d'impulsion)
-                    // Vitesse relative
-                    float dvx = p2.velocity.x - p1.velocity.x;
-                    float dvy = p2.velocity.y - p1.velocity.y;
-
-                    // Produit scalaire vitesse relative . normale
-                    float dotProduct = dvx * nx + dvy * ny;
-
-                    // Si les particules s'loignent dj, on ne fait rien
-                    if (dotProduct > 0) continue;
-
-                    // Calcul de l'impulsion scalaire
-                    // On utilise la moyenne des coefficients de restitution des deux particules
-                    float currentRestitution = m_rebond;
-                    float impulseScale = -(1.0f + currentRestitution) * dotProduct;
-
-                    // On divise par la somme des masses inverses (ici masse = 1 pour tout le monde)
-                    impulseScale /= 2.0f;
-
-                    // Application de l'impulsion
-                    float impulseX = nx * impulseScale;
-                    float impulseY = ny * impulseScale;
-
-                    p1.velocity.x -= impulseX;
-                    p1.velocity.y -= impulseY;
-                    p2.velocity.x += impulseX;
-                    p2.velocity.y += impulseY;
-                }
-            }
-        }
+    // Delta Time fixe pour la simulation
+    float dt = SIMULATION_DT;
+
+    // Puits et metteur suivent la taille de la fentre
+    updateStreamGeometry();
+    const Sink* sinks = m_sinkActive ? &m_sink : nullptr;
+    int sinkCount = m_sinkActive ? 1 : 0;
+
+    // Les backends CPU et GPU ont la mme signature : ils renvoient le nombre de particules
+    // vivantes, compactes en tte du tableau. resize() ne fait que rduire (pas de rallocation).
+    int before = (int)m_particles.size();
+    // On vrifie qu'il y a des particules
+    if (!m_particles.empty()) {
+        auto update = (m_computeMode == GPU) ? updateParticlesCUDA : updateParticlesCPU;
+        int alive = update(
+            m_particles.data(),
+            (int)m_particles.size(),
+            dt,
+            m_gravity,
+            m_friction,
+            m_rebond,
+            width(),
+            height(),
+            m_mousePos.x,
+            m_mousePos.y,
+            m_cursorEffectStrength,
+            m_cursorEffectRadius,
+            m_cursorActive,
+            sinks,
+            sinkCount
+        );
+        m_particles.resize(alive);
     }
-    else if (m_computeMode == GPU) {
-        float dt = 1.0f / 60.0f;
-
-        // On vrifie qu'il y a des particules
-        if (!m_particles.empty()) {
-            // C'est ce qui connecte correctement votre vecteur C++ au pointeur C du Kernel
-            updateParticlesCUDA(
-                m_particles.data(),
-                m_particles.size(),
-                dt,
-                m_gravity,
-                m_friction,
-                m_rebond,
-                width(),
-                height(),
-                m_mousePos.x,
-                m_mousePos.y,
-                m_cursorEffectStrength,
-                m_cursorEffectRadius,
-                m_cursorActive
-            );
-        }
+    m_despawnedCount += before - (int)m_particles.size();
+
+    // Emission dans les emplacements librs
+    spawnParticles(dt);
+
+    // Dbits de cration / destruction (par seconde relle)
+    auto now = std::chrono::steady_clock::now();
+    float elapsed = std::chrono::duration<float>(now - m_streamStatsTime).count();
+    if (elapsed >= 1.0f) {
+        m_spawnRate = (int)(m_spawnedCount / elapsed);
+        m_despawnRate = (int)(m_despawnedCount / elapsed);
+        m_dropRate = (int)(m_droppedCount / elapsed);
+        m_spawnedCount = 0;
+        m_despawnedCount = 0;
+        m_droppedCount = 0;
+        m_streamStatsTime = now;
     }
 }
 
@@ -228,6 +164,18 @@ void RaylibWidget::drawToTexture() {
     BeginTextureMode(m_renderTexture);
     ClearBackground({ 20, 20, 30, 255 });
 
+    // --- VISUALISATION FLUX ---
+    if (m_sinkActive) {
+        DrawCircleV(m_sink.position, m_sink.radius, { 0, 0, 0, 120 });
+        DrawCircleLines((int)m_sink.position.x, (int)m_sink.position.y, m_sink.radius, ORANGE);
+    }
+    if (m_emitterActive) {
+        Vector2 tip = { m_emitter.position.x + std::cos(m_emitter.direction) * 30.0f,
+                        m_emitter.position.y + std::sin(m_emitter.direction) * 30.0f };
+        DrawLineV(m_emitter.position, tip, ORANGE);
+        DrawCircleV(m_emitter.position, 6.0f, ORANGE);
+    }
+
     // --- VISUALISATION CURSEUR ---
     if (m_cursorActive) {
         Color areaColor;
@@ -242,13 +190,30 @@ void RaylibWidget::drawToTexture() {
     }
  
 	// Dessin des particules
-    for (const auto& p : m_particles) {
-        DrawCircleV(p.position, p.radius, p.color);
+    if ((int)m_particles.size() > POINT_RENDER_THRESHOLD) {
+        drawParticlePoints();
+    }
+    else {
+        for (const auto& p : m_particles) {
+            DrawCircleV(p.position, p.radius, p.color);
+        }
+    }
+
+    // Pendant l'export, les frames sont enregistres sans l'overlay
+    if (m_exporter.isRunning()) {
+        EndTextureMode();
+        return;
     }
 
 	// Affichage FPS et Count
     DrawText(TextFormat("%i FPS", m_currentFPS), 10, 10, 20, GREEN);
     DrawText(TextFormat("Count: %i", (int)m_particles.size()), 10, 30, 20, LIGHTGRAY);
+    if (m_emitterActive || m_sinkActive) {
+        DrawText(TextFormat("Flux: +%i/s -%i/s", m_spawnRate, m_despawnRate), 10, 50, 20, LIGHTGRAY);
+        if (m_dropRate > 0) {
+            DrawText(TextFormat("Capacite %i atteinte : %i emissions/s abandonnees", m_capacity, m_dropRate), 10, 70, 20, ORANGE);
+        }
+    }
 
     if (m_isPaused) {
         DrawText("PAUSE", width() / 2 - 50, height() / 2, 40, RAYWHITE);
@@ -257,6 +222,29 @@ void RaylibWidget::drawToTexture() {
     EndTextureMode();
 }
 
+// Texture des points,  la taille du rendu
+void RaylibWidget::loadPointsTexture() {
+    Image blank = GenImageColor(width(), height(), BLANK);
+    m_pointsTexture = LoadTextureFromImage(blank);
+    UnloadImage(blank);
+    m_pointsPixels.assign((size_t)width() * height(), BLANK);
+}
+
+// Un pixel par particule (la dernire crite l'emporte), une seule texture envoye au GPU par frame
+void RaylibWidget::drawParticlePoints() {
+    int w = m_pointsTexture.width;
+    int h = m_pointsTexture.height;
+    std::fill(m_pointsPixels.begin(), m_pointsPixels.end(), BLANK);
+    for (const auto& p : m_particles) {
+        int x = (int)p.position.x;
+        int y = (int)p.position.y;
+        if (x < 0 || y < 0 || x >= w || y >= h) continue;
+        m_pointsPixels[(size_t)y * w + x] = p.color;
+    }
+    UpdateTexture(m_pointsTexture, m_pointsPixels.data());
+    DrawTexture(m_pointsTexture, 0, 0, WHITE);
+}
+
 // Boucle de rendu principale
 void RaylibWidget::paintEvent(QPaintEvent*) {
     if (!m_isInitialized) {
@@ -276,6 +264,35 @@ void RaylibWidget::paintEvent(QPaintEvent*) {
     drawToTexture();
 
     Image image = LoadImageFromTexture(m_renderTexture.texture);
+
+    // --- EXPORT ---
+    // Une frame par pas de simulation (dt fixe), indpendamment de l'horloge
+    if (m_exporter.isRunning() && !m_isPaused) {
+        bool submitted = m_exporter.submit((unsigned char*)image.data, image.width, image.height, true);
+
+        // Hors cran : on enchane les pas sans attendre le rafrachissement Qt
+        if (submitted && m_exportOffscreen) {
+            auto frameStart = std::chrono::steady_clock::now();
+            while (std::chrono::steady_clock::now() - frameStart < std::chrono::milliseconds(15)) {
+                UnloadImage(image);
+                updatePhysics();
+                drawToTexture();
+                image = LoadImageFromTexture(m_renderTexture.texture);
+                if (!m_exporter.submit((unsigned char*)image.data, image.width, image.height, true)) {
+                    submitted = false;
+                    break;
+                }
+            }
+        }
+
+        // Frame refuse (fentre redimensionne...) : la squence sauterait du temps simul, on arrte l'export
+        if (!submitted) {
+            fprintf(stderr, "Export interrompu : frame %dx%d refusee\n", image.width, image.height);
+            m_exporter.stop();
+            emit exportStopped();
+        }
+    }
+
     // Raylib est invers en Y par rapport  Qt, on utilise .mirrored()
     QImage qimg((uchar*)image.data, image.width, image.height, QImage::Format_RGBA8888);
     QImage displayedImage = qimg.mirrored();
@@ -283,6 +300,14 @@ void RaylibWidget::paintEvent(QPaintEvent*) {
     QPainter painter(this);
     painter.drawImage(0, 0, displayedImage);
 
+    if (m_exporter.isRunning()) {
+        painter.setPen(Qt::green);
+        painter.drawText(10, 20, QString("Export: %1 frames, %2 fps (%3 attentes)")
+            .arg(m_exporter.framesWritten())
+            .arg(m_exporter.exportFPS(), 0, 'f', 1)
+            .arg(m_exporter.stalls()));
+    }
+
     UnloadImage(image);
     update();
 }
@@ -293,6 +318,8 @@ void RaylibWidget::resizeEvent(QResizeEvent* event) {
     if (m_isInitialized) {
         UnloadRenderTexture(m_renderTexture);
         m_renderTexture = LoadRenderTexture(width(), height());
+        UnloadTexture(m_pointsTexture);
+        loadPointsTexture();
     }
 }
 
@@ -303,24 +330,30 @@ void RaylibWidget::setParticleSize(float s) {
     for (auto& p : m_particles) p.radius = m_particleRadius;
 }
 
-    // Ajuste le nombre de particules
+    // Ajuste le nombre de particules permanentes (dure de vie infinie).
+    // Les particules du flux sont mlanges aux permanentes dans m_particles : elles ne sont ni
+    // comptes ni retires ici, seul l'metteur / le vieillissement les gre.
 void RaylibWidget::setParticleCount(int count) {
     m_targetCount = count;
-    int currentSize = (int)m_particles.size();
+    reserveCapacity();
+    int immortalCount = 0;
+    for (const auto& p : m_particles) {
+        if (p.life >= PARTICLE_IMMORTAL) immortalCount++;
+    }
 
-    if (count < currentSize) {
-        m_particles.resize(count);
+    if (count < immortalCount) {
+        // On garde les "count" premires permanentes, compaction en place (ordre conserv)
+        int kept = 0;
+        int keptImmortal = 0;
+        for (const auto& p : m_particles) {
+            if (p.life >= PARTICLE_IMMORTAL && keptImmortal++ >= count) continue;
+            m_particles[kept++] = p;
+        }
+        m_particles.resize(kept);
     }
-    else if (count > currentSize) {
-        for (int i = 0; i < (count - currentSize); i++) {
-            Particle p;
-            p.position = { (float)GetRandomValue(0, width()), (float)GetRandomValue(0, height()) };
-            float vx = (float)GetRandomValue(-100, 100) / 10.0f;
-            float vy = (float)GetRandomValue(-100, 100) / 10.0f;
-            p.velocity = { vx * m_velocityScale, vy * m_velocityScale };
-            p.radius = m_particleRadius;
-            p.color = { (unsigned char)GetRandomValue(50, 255), (unsigned char)GetRandomValue(50, 255), 255, 255 };
-            m_particles.push_back(p);
+    else if (count > immortalCount) {
+        for (int i = 0; i < (count - immortalCount); i++) {
+            m_particles.push_back(makeRandomParticle());
         }
     }
 }
@@ -347,4 +380,100 @@ void RaylibWidget::setInitialVelocityScale(float v) {
 void RaylibWidget::setComputeMode(ComputeMode mode) {
     m_computeMode = mode;
     reset();
-}
\ No newline at end of file
+}
+
+// --- EXPORT ---
+    // Dmarre l'export  la taille actuelle du rendu (60 frames par seconde simule)
+bool RaylibWidget::startExport(const std::string& outputDir, FrameExporter::Format format, bool offscreen) {
+    if (!m_isInitialized) return false;
+    m_exportOffscreen = offscreen;
+    return m_exporter.start(outputDir, format, m_renderTexture.texture.width, m_renderTexture.texture.height, (int)std::lround(1.0f / SIMULATION_DT));
+}
+
+void RaylibWidget::stopExport() {
+    m_exporter.stop();
+}
+
+    // Le widget n'est jamais affich : rien ne dpend de paintEvent ni du rafrachissement Qt,
+    // la simulation n'attend que l'encodage (file pleine)
+bool RaylibWidget::exportHeadless(const std::string& outputDir, FrameExporter::Format format, int frameCount) {
+    if (!m_isInitialized) initRaylib();
+    if (!startExport(outputDir, format, false)) return false;
+
+    for (int i = 0; i < frameCount; i++) {
+        updatePhysics();
+        drawToTexture();
+        Image image = LoadImageFromTexture(m_renderTexture.texture);
+        bool submitted = m_exporter.submit((unsigned char*)image.data, image.width, image.height, true);
+        UnloadImage(image);
+        if (!submitted) {
+            fprintf(stderr, "Export interrompu : frame %d refusee\n", i);
+            break;
+        }
+    }
+
+    m_exporter.stop();
+    return m_exporter.framesWritten() == frameCount;
+}
+
+// --- FLUX CONTINU ---
+    // Emetteur en bas  gauche (tir vers le haut / la droite), puits en bas  droite
+void RaylibWidget::updateStreamGeometry() {
+    m_emitter.position = { width() * 0.1f, height() * 0.9f };
+    m_sink.position = { width() * 0.85f, height() * 0.8f };
+}
+
+    // Emission : le dbit est accumul d'un pas  l'autre, la capacit n'est jamais dpasse
+void RaylibWidget::spawnParticles(float dt) {
+    if (!m_emitterActive) return;
+
+    m_emitter.accumulator += m_emitter.rate * dt;
+    int toSpawn = (int)m_emitter.accumulator;
+    m_emitter.accumulator -= toSpawn;
+
+    int freeSlots = m_capacity - (int)m_particles.size();
+    if (freeSlots < 0) freeSlots = 0;
+    if (toSpawn > freeSlots) {
+        if (!m_dropReported) {
+            fprintf(stderr, "Flux : capacite de %d particules atteinte, les emissions en trop sont abandonnees\n", m_capacity);
+            m_dropReported = true;
+        }
+        m_droppedCount += toSpawn - freeSlots;
+        toSpawn = freeSlots;
+    }
+
+    std::uniform_real_distribution<float> angle(-m_emitter.spread, m_emitter.spread);
+    std::uniform_real_distribution<float> speed(m_emitter.speedMin, m_emitter.speedMax);
+    std::uniform_real_distribution<float> jitter(-m_emitter.lifetimeJitter, m_emitter.lifetimeJitter);
+    std::uniform_int_distribution<int> shade(50, 255);
+
+    for (int i = 0; i < toSpawn; i++) {
+        float a = m_emitter.direction + angle(m_rng);
+        float v = speed(m_rng) * m_velocityScale;
+
+        Particle p;
+        p.position = m_emitter.position;
+        p.velocity = { std::cos(a) * v, std::sin(a) * v };
+        p.radius = m_particleRadius;
+        p.color = { (unsigned char)shade(m_rng), (unsigned char)shade(m_rng), 255, 255 };
+        p.life = m_emitter.lifetime + jitter(m_rng);
+        if (p.life < dt) p.life = dt;
+        m_particles.push_back(p);
+    }
+    m_spawnedCount += toSpawn;
+}
+
+void RaylibWidget::setEmitterActive(bool active) { m_emitterActive = active; }
+void RaylibWidget::setEmitterRate(float rate) { m_emitter.rate = rate; reserveCapacity(); }
+void RaylibWidget::setEmitterLifetime(float seconds) { m_emitter.lifetime = seconds; reserveCapacity(); }
+void RaylibWidget::setEmitterSpread(float degrees) { m_emitter.spread = degrees * 3.14159265f / 180.0f; }
+void RaylibWidget::setEmitterLifetimeJitter(float seconds) { m_emitter.lifetimeJitter = seconds; reserveCapacity(); }
+void RaylibWidget::setEmitterDirection(float degrees) { m_emitter.direction = -degrees * 3.14159265f / 180.0f; } // Y vers le bas
+
+    // Plage de vitesse initiale (px par pas) : bornes remises dans l'ordre pour la distribution uniforme
+void RaylibWidget::setEmitterSpeed(float minSpeed, float maxSpeed) {
+    if (maxSpeed < minSpeed) std::swap(minSpeed, maxSpeed);
+    m_emitter.speedMin = minSpeed;
+    m_emitter.speedMax = maxSpeed;
+}
+void RaylibWidget::setSinkActive(bool active) { m_sinkActive = active; }
\ No newline at end of file
@@ -3,8 +3,11 @@
 #include <vector>
 #include <raylib.h>
 #include <chrono>
+#include <random>
 #include <QMouseEvent> // Ncessaire pour les vnements souris
 #include "Particle.h"
+#include "FrameExporter.h"
+#include "ParticleStream.h"
 
 class RaylibWidget : public QWidget {
     Q_OBJECT
@@ -23,6 +26,13 @@ public:
     void reset();
     void setComputeMode(ComputeMode mode);
 
+    // Export des frames (PNG / Y4M)  cadence simule fixe
+    bool startExport(const std::string& outputDir, FrameExporter::Format format, bool offscreen);
+    void stopExport();
+    bool isExporting() const { return m_exporter.isRunning(); }
+    // Export sans affichage : frameCount pas simuls, rendus et encods sans boucle d'vnements Qt
+    bool exportHeadless(const std::string& outputDir, FrameExporter::Format format, int frameCount);
+
     // Physique Globale
     void setGravity(float g);
     void setFriction(float f);
@@ -36,6 +46,21 @@ public:
     void setCursorRadius(float radius);
     void setCursorStrength(float strength);
 
+    // Flux continu (metteur / puits)
+    void setEmitterActive(bool active);
+    void setEmitterRate(float rate);
+    void setEmitterLifetime(float seconds);
+    void setEmitterSpread(float degrees);
+    void setEmitterLifetimeJitter(float seconds);
+    void setEmitterSpeed(float minSpeed, float maxSpeed);
+    // Degrs, sens trigonomtrique  l'cran (0 = vers la droite, 90 = vers le haut)
+    void setEmitterDirection(float degrees);
+    void setSinkActive(bool active);
+
+signals:
+    // Emis quand l'export s'arrte de lui-mme (frame refuse)
+    void exportStopped();
+
 protected:
     void paintEvent(QPaintEvent* event) override;
     void resizeEvent(QResizeEvent* event) override;
@@ -46,8 +71,16 @@ protected:
 private:
     void initRaylib();
     void initParticles();
+    Particle makeRandomParticle();
+    void reserveCapacity();
     void updatePhysics();
     void drawToTexture();
+    void loadPointsTexture();
+    void drawParticlePoints();
+
+    // Flux continu
+    void updateStreamGeometry();
+    void spawnParticles(float dt);
 
     bool m_isInitialized = false;
     bool m_isPaused = false;
@@ -56,6 +89,9 @@ private:
     ComputeMode m_computeMode = CPU;
 
     RenderTexture2D m_renderTexture;
+    // Rendu en points des grands nombres de particules (buffer CPU -> texture)
+    Texture2D m_pointsTexture;
+    std::vector<Color> m_pointsPixels;
     std::vector<Particle> m_particles;
 
     // Valeurs de base pour la physique
@@ -72,6 +108,29 @@ private:
     float m_cursorEffectRadius = 150.0f;
     float m_cursorEffectStrength = 0.0f; // 0 = Neutre
 
+    // Flux continu : un metteur, un puits, capacit dimensionne par les rglages (aucune rallocation en rgime tabli).
+    // Au-del de m_capacity particules vivantes les missions sont abandonnes (comptes dans m_droppedCount).
+    Emitter m_emitter = { { 0.0f, 0.0f }, 2000.0f, -1.0f, 0.35f, 6.0f, 12.0f, 5.0f, 1.0f, 0.0f };
+    bool m_emitterActive = false;
+    Sink m_sink = { { 0.0f, 0.0f }, 80.0f };
+    bool m_sinkActive = false;
+    int m_capacity = 0;
+    std::mt19937 m_rng{ 12345 };
+
+    // Statistiques de flux (particules cres / dtruites / abandonnes par seconde)
+    int m_spawnedCount = 0;
+    int m_despawnedCount = 0;
+    int m_droppedCount = 0;
+    int m_spawnRate = 0;
+    int m_despawnRate = 0;
+    int m_dropRate = 0;
+    bool m_dropReported = false;
+    std::chrono::steady_clock::time_point m_streamStatsTime;
+
+    // Export : offscreen = plusieurs pas de simulation par rafrachissement
+    FrameExporter m_exporter;
+    bool m_exportOffscreen = false;
+
     // Variables calcul FPS
     std::chrono::steady_clock::time_point m_lastTime;
     int m_currentFPS = 0;